@@ -13,6 +13,10 @@
 #include <set>
 #include <sstream>
 
+#ifdef NUMA
+#include <numa.h>
+#endif
+
 #include "db/db_impl/db_impl.h"
 #include "monitoring/histogram.h"
 #include "port/port.h"
@@ -49,6 +53,10 @@ DEFINE_double(resident_ratio, 0.25,
               "Ratio of keys fitting in cache to keyspace.");
 DEFINE_uint64(ops_per_thread, 2000000U, "Number of operations per thread.");
 DEFINE_uint32(value_bytes, 8 * KiB, "Size of each value added.");
+DEFINE_uint32(value_bytes_estimate, 0,
+              "If > 0, overrides estimated_entry_charge for "
+              "hyper_clock_cache (otherwise value_bytes is used). Ignored "
+              "by auto_hyper_clock_cache, which needs no estimate.");
 
 DEFINE_uint32(skew, 5, "Degree of skew in key selection");
 DEFINE_bool(populate_cache, true, "Populate cache before operations");
@@ -81,7 +89,14 @@ DEFINE_string(secondary_cache_uri, "",
               "Full URI for creating a custom secondary cache object");
 static class std::shared_ptr<ROCKSDB_NAMESPACE::SecondaryCache> secondary_cache;
 
-DEFINE_string(cache_type, "lru_cache", "Type of block cache.");
+DEFINE_string(cache_type, "lru_cache",
+              "Type of block cache: lru_cache, hyper_clock_cache, or "
+              "auto_hyper_clock_cache (growable hyper_clock_cache).");
+
+DEFINE_bool(numa_aware, false,
+            "For hyper_clock_cache, spread shard tables over NUMA nodes "
+            "(HyperClockCacheOptions::numa_aware) and bind the benchmark "
+            "threads round-robin to NUMA nodes. Requires NUMA support.");
 
 // ## BEGIN stress_cache_key sub-tool options ##
 // See class StressCacheKey below.
@@ -298,10 +313,18 @@ class CacheBench {
     if (FLAGS_cache_type == "clock_cache") {
       fprintf(stderr, "Old clock cache implementation has been removed.\n");
       exit(1);
-    } else if (FLAGS_cache_type == "hyper_clock_cache") {
-      cache_ = HyperClockCacheOptions(FLAGS_cache_size, FLAGS_value_bytes,
-                                      FLAGS_num_shard_bits)
-                   .MakeSharedCache();
+    } else if (FLAGS_cache_type == "hyper_clock_cache" ||
+               FLAGS_cache_type == "auto_hyper_clock_cache") {
+      size_t estimated_entry_charge = 0;
+      if (FLAGS_cache_type == "hyper_clock_cache") {
+        estimated_entry_charge = FLAGS_value_bytes_estimate > 0
+                                     ? FLAGS_value_bytes_estimate
+                                     : FLAGS_value_bytes;
+      }
+      HyperClockCacheOptions opts(FLAGS_cache_size, estimated_entry_charge,
+                                  FLAGS_num_shard_bits);
+      opts.numa_aware = FLAGS_numa_aware;
+      cache_ = opts.MakeSharedCache();
     } else if (FLAGS_cache_type == "lru_cache") {
       LRUCacheOptions opts(FLAGS_cache_size, FLAGS_num_shard_bits,
                            false /* strict_capacity_limit */,
@@ -345,6 +368,16 @@ class CacheBench {
     SharedState shared(this);
     std::vector<std::unique_ptr<ThreadState> > threads(FLAGS_threads);
     for (uint32_t i = 0; i < FLAGS_threads; i++) {
+#ifdef NUMA
+      if (FLAGS_numa_aware) {
+        // The thread created below inherits the binding to this node.
+        bitmask* nodes = numa_allocate_nodemask();
+        numa_bitmask_clearall(nodes);
+        numa_bitmask_setbit(nodes, i % numa_num_task_nodes());
+        numa_bind(nodes);
+        numa_free_nodemask(nodes);
+      }
+#endif
       threads[i].reset(new ThreadState(i, &shared));
       std::thread(ThreadBody, threads[i].get()).detach();
     }
@@ -620,6 +653,7 @@ class CacheBench {
     printf("Cache size          : %s\n",
            BytesToHumanString(FLAGS_cache_size).c_str());
     printf("Num shard bits      : %u\n", FLAGS_num_shard_bits);
+    printf("NUMA aware          : %d\n", int{FLAGS_numa_aware});
     printf("Max key             : %" PRIu64 "\n", max_key_);
     printf("Resident ratio      : %g\n", FLAGS_resident_ratio);
     printf("Skew degree         : %u\n", FLAGS_skew);
@@ -952,6 +986,18 @@ int cache_bench_tool(int argc, char** argv) {
     exit(1);
   }
 
+  if (FLAGS_numa_aware) {
+#ifndef NUMA
+    fprintf(stderr, "NUMA is not defined in the system.\n");
+    exit(1);
+#else
+    if (numa_available() == -1) {
+      fprintf(stderr, "NUMA is not supported by the system.\n");
+      exit(1);
+    }
+#endif
+  }
+
   ROCKSDB_NAMESPACE::CacheBench bench;
   if (FLAGS_populate_cache) {
     bench.PopulateCache();
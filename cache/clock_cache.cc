@@ -12,6 +12,10 @@
 #include <functional>
 #include <numeric>
 
+#ifdef NUMA
+#include <numa.h>
+#endif
+
 #include "cache/cache_key.h"
 #include "cache/secondary_cache_adapter.h"
 #include "logging/logging.h"
@@ -131,16 +135,29 @@ HyperClockTable::HyperClockTable(
     CacheMetadataChargePolicy metadata_charge_policy,
     MemoryAllocator* allocator,
     const Cache::EvictionCallback* eviction_callback, const Opts& opts)
-    : length_bits_(CalcHashBits(capacity, opts.estimated_value_size,
-                                metadata_charge_policy)),
-      length_bits_mask_((size_t{1} << length_bits_) - 1),
-      occupancy_limit_(static_cast<size_t>((uint64_t{1} << length_bits_) *
+    : max_length_bits_(CalcHashBits(capacity,
+                                    opts.estimated_value_size > 0
+                                        ? opts.estimated_value_size
+                                        : kMinGrowableAvgEntryCharge,
+                                    metadata_charge_policy)),
+      min_length_bits_(opts.estimated_value_size > 0
+                           ? max_length_bits_
+                           : std::min(max_length_bits_,
+                                      kGrowableInitialLengthBits)),
+      length_bits_(min_length_bits_),
+      occupancy_limit_(static_cast<size_t>((uint64_t{1} << min_length_bits_) *
                                            kStrictLoadFactor)),
-      array_(new HandleImpl[size_t{1} << length_bits_]),
+      charge_metadata_(metadata_charge_policy ==
+                       CacheMetadataChargePolicy::kFullChargeCacheMetadata),
+      occupancy_by_length_bits_(
+          IsGrowable() ? new std::atomic<size_t>[max_length_bits_ -
+                                                 min_length_bits_ + 1]()
+                       : nullptr),
+      array_(NewArray(size_t{1} << max_length_bits_, opts.numa_node,
+                      IsGrowable())),
       allocator_(allocator),
       eviction_callback_(*eviction_callback) {
-  if (metadata_charge_policy ==
-      CacheMetadataChargePolicy::kFullChargeCacheMetadata) {
+  if (charge_metadata_) {
     usage_ += size_t{GetTableSize()} * sizeof(HandleImpl);
   }
 
@@ -162,7 +179,7 @@ HyperClockTable::~HyperClockTable() {
         assert(GetRefcount(h.meta) == 0);
         h.FreeData(allocator_);
 #ifndef NDEBUG
-        Rollback(h.hashed_key, &h);
+        Rollback(h.hashed_key, &h, h.length_bits);
         ReclaimEntryUsage(h.GetTotalCharge());
 #endif
         break;
@@ -184,6 +201,55 @@ HyperClockTable::~HyperClockTable() {
   assert(occupancy_ == 0);
 }
 
+std::unique_ptr<HyperClockTable::HandleImpl[], HyperClockTable::ArrayDeleter>
+HyperClockTable::NewArray(size_t length, int numa_node, bool lazy) {
+  if (lazy) {
+    // All-zero slots are empty slots
+    auto mapping = std::make_unique<MemMapping>(
+        MemMapping::AllocateLazyZeroed(length * sizeof(HandleImpl)));
+    if (mapping->Get() != nullptr) {
+      HandleImpl* array = static_cast<HandleImpl*>(mapping->Get());
+      return {array, ArrayDeleter{0, std::move(mapping)}};
+    }
+    // Fall back on allocating up front
+  }
+#ifdef NUMA
+  if (numa_node >= 0) {
+    size_t size = length * sizeof(HandleImpl);
+    void* mem = numa_alloc_onnode(size, numa_node);
+    if (mem != nullptr) {
+      HandleImpl* array = static_cast<HandleImpl*>(mem);
+      for (size_t i = 0; i < length; i++) {
+        new (&array[i]) HandleImpl();
+      }
+      return {array, ArrayDeleter{size, nullptr}};
+    }
+    // Fall back on the default policy
+  }
+#else
+  (void)numa_node;
+#endif
+  return {new HandleImpl[length], ArrayDeleter{}};
+}
+
+void HyperClockTable::ArrayDeleter::operator()(HandleImpl* array) const {
+  if (lazy_mapping) {
+    // Unmapped along with lazy_mapping
+    assert(array == lazy_mapping->Get());
+    return;
+  }
+#ifdef NUMA
+  if (numa_alloc_size > 0) {
+    for (size_t i = 0; i < numa_alloc_size / sizeof(HandleImpl); i++) {
+      array[i].~HandleImpl();
+    }
+    numa_free(array, numa_alloc_size);
+    return;
+  }
+#endif
+  delete[] array;
+}
+
 // If an entry doesn't receive clock updates but is repeatedly referenced &
 // released, the acquire and release counters could overflow without some
 // intervention. This is that intervention, which should be inexpensive
@@ -399,8 +465,15 @@ Status HyperClockTable::Insert(const ClockHandleBasicData& proto,
   auto revert_occupancy_fn = [&]() {
     occupancy_.fetch_sub(1, std::memory_order_relaxed);
   };
+  int length_bits = GetLengthBits();
+  if (UNLIKELY(length_bits < max_length_bits_) &&
+      old_occupancy >= (uint64_t{1} << length_bits) * kLoadFactor) {
+    // Growable table at target load factor
+    Grow(length_bits);
+    length_bits = GetLengthBits();
+  }
   // Whether we over-committed and need an eviction to make up for it
-  bool need_evict_for_occupancy = old_occupancy >= occupancy_limit_;
+  bool need_evict_for_occupancy = old_occupancy >= GetOccupancyLimit();
 
   // Usage/capacity handling is somewhat different depending on
   // strict_capacity_limit, but mostly pessimistic.
@@ -449,6 +522,10 @@ Status HyperClockTable::Insert(const ClockHandleBasicData& proto,
     uint64_t initial_countdown = GetInitialCountdown(priority);
     assert(initial_countdown > 0);
 
+    if (occupancy_by_length_bits_) {
+      occupancy_by_length_bits_[length_bits - min_length_bits_].fetch_add(
+          1, std::memory_order_relaxed);
+    }
     size_t probe = 0;
     HandleImpl* e = FindSlot(
         proto.hashed_key,
@@ -466,6 +543,7 @@ Status HyperClockTable::Insert(const ClockHandleBasicData& proto,
             // ownership Save data fields
             ClockHandleBasicData* h_alias = h;
             *h_alias = proto;
+            h->length_bits = static_cast<uint8_t>(length_bits);
 
             // Transition from "under construction" state to "visible" state
             uint64_t new_meta = uint64_t{ClockHandle::kStateVisible}
@@ -537,7 +615,7 @@ Status HyperClockTable::Insert(const ClockHandleBasicData& proto,
         [&](HandleImpl* h) {
           h->displacements.fetch_add(1, std::memory_order_relaxed);
         },
-        probe);
+        probe, length_bits);
     if (e == nullptr) {
       // Occupancy check and never abort FindSlot above should generally
       // prevent this, except it's theoretically possible for other threads
@@ -546,7 +624,7 @@ Status HyperClockTable::Insert(const ClockHandleBasicData& proto,
       // should be no higher than pow(kStrictLoadFactor, n) for n slots.
       // That should be infeasible for roughly n >= 256, so if this assertion
       // fails, that suggests something is going wrong.
-      assert(GetTableSize() < 256);
+      assert((size_t{1} << length_bits) < 256);
       use_standalone_insert = true;
     }
     if (!use_standalone_insert) {
@@ -557,7 +635,7 @@ Status HyperClockTable::Insert(const ClockHandleBasicData& proto,
       return Status::OK();
     }
     // Roll back table insertion
-    Rollback(proto.hashed_key, e);
+    Rollback(proto.hashed_key, e, length_bits);
     revert_occupancy_fn();
     // Maybe fall back on standalone insert
     if (handle == nullptr) {
@@ -611,8 +689,7 @@ HyperClockTable::HandleImpl* HyperClockTable::CreateStandalone(
 
 HyperClockTable::HandleImpl* HyperClockTable::Lookup(
     const UniqueId64x2& hashed_key) {
-  size_t probe = 0;
-  HandleImpl* e = FindSlot(
+  HandleImpl* e = FindSlotAnySize(
       hashed_key,
       [&](HandleImpl* h) {
         // Mostly branch-free version (similar performance)
@@ -670,8 +747,7 @@ HyperClockTable::HandleImpl* HyperClockTable::Lookup(
       },
       [&](HandleImpl* h) {
         return h->displacements.load(std::memory_order_relaxed) == 0;
-      },
-      [&](HandleImpl* /*h*/) {}, probe);
+      });
 
   return e;
 }
@@ -739,7 +815,7 @@ bool HyperClockTable::Release(HandleImpl* h, bool useful,
       standalone_usage_.fetch_sub(total_charge, std::memory_order_relaxed);
       usage_.fetch_sub(total_charge, std::memory_order_relaxed);
     } else {
-      Rollback(h->hashed_key, h);
+      Rollback(h->hashed_key, h, h->length_bits);
       FreeDataMarkEmpty(*h, allocator_);
       ReclaimEntryUsage(total_charge);
     }
@@ -787,8 +863,7 @@ void HyperClockTable::TEST_ReleaseN(HandleImpl* h, size_t n) {
 }
 
 void HyperClockTable::Erase(const UniqueId64x2& hashed_key) {
-  size_t probe = 0;
-  (void)FindSlot(
+  (void)FindSlotAnySize(
       hashed_key,
       [&](HandleImpl* h) {
         // Could be multiple entries in rare cases. Erase them all.
@@ -825,11 +900,12 @@ void HyperClockTable::Erase(const UniqueId64x2& hashed_key) {
                 // Took ownership
                 assert(hashed_key == h->hashed_key);
                 size_t total_charge = h->GetTotalCharge();
+                int length_bits = h->length_bits;
                 FreeDataMarkEmpty(*h, allocator_);
                 ReclaimEntryUsage(total_charge);
                 // We already have a copy of hashed_key in this case, so OK to
                 // delay Rollback until after releasing the entry
-                Rollback(hashed_key, h);
+                Rollback(hashed_key, h, length_bits);
                 break;
               }
             }
@@ -853,8 +929,7 @@ void HyperClockTable::Erase(const UniqueId64x2& hashed_key) {
       },
       [&](HandleImpl* h) {
         return h->displacements.load(std::memory_order_relaxed) == 0;
-      },
-      [&](HandleImpl* /*h*/) {}, probe);
+      });
 }
 
 void HyperClockTable::ConstApplyToEntriesRange(
@@ -899,7 +974,8 @@ void HyperClockTable::ConstApplyToEntriesRange(
 }
 
 void HyperClockTable::EraseUnRefEntries() {
-  for (size_t i = 0; i <= this->length_bits_mask_; i++) {
+  size_t table_size = GetTableSize();
+  for (size_t i = 0; i < table_size; i++) {
     HandleImpl& h = array_[i];
 
     uint64_t old_meta = h.meta.load(std::memory_order_relaxed);
@@ -912,7 +988,7 @@ void HyperClockTable::EraseUnRefEntries() {
                                        std::memory_order_acquire)) {
       // Took ownership
       size_t total_charge = h.GetTotalCharge();
-      Rollback(h.hashed_key, &h);
+      Rollback(h.hashed_key, &h, h.length_bits);
       FreeDataMarkEmpty(h, allocator_);
       ReclaimEntryUsage(total_charge);
     }
@@ -920,9 +996,11 @@ void HyperClockTable::EraseUnRefEntries() {
 }
 
 inline HyperClockTable::HandleImpl* HyperClockTable::FindSlot(
-    const UniqueId64x2& hashed_key, std::function<bool(HandleImpl*)> match_fn,
-    std::function<bool(HandleImpl*)> abort_fn,
-    std::function<void(HandleImpl*)> update_fn, size_t& probe) {
+    const UniqueId64x2& hashed_key,
+    const std::function<bool(HandleImpl*)>& match_fn,
+    const std::function<bool(HandleImpl*)>& abort_fn,
+    const std::function<void(HandleImpl*)>& update_fn, size_t& probe,
+    int length_bits) {
   // NOTE: upper 32 bits of hashed_key[0] is used for sharding
   //
   // We use double-hashing probing. Every probe in the sequence is a
@@ -936,8 +1014,9 @@ inline HyperClockTable::HandleImpl* HyperClockTable::FindSlot(
   // TODO: we could also reconsider linear probing, though locality benefits
   // are limited because each slot is a full cache line
   size_t increment = static_cast<size_t>(hashed_key[0]) | 1U;
-  size_t current = ModTableSize(base + probe * increment);
-  while (probe <= length_bits_mask_) {
+  size_t current = ModTableSize(base + probe * increment, length_bits);
+  const size_t length_bits_mask = (size_t{1} << length_bits) - 1;
+  while (probe <= length_bits_mask) {
     HandleImpl* h = &array_[current];
     if (match_fn(h)) {
       probe++;
@@ -948,19 +1027,67 @@ inline HyperClockTable::HandleImpl* HyperClockTable::FindSlot(
     }
     probe++;
     update_fn(h);
-    current = ModTableSize(current + increment);
+    current = ModTableSize(current + increment, length_bits);
   }
   // We looped back.
   return nullptr;
 }
 
+inline HyperClockTable::HandleImpl* HyperClockTable::FindSlotAnySize(
+    const UniqueId64x2& hashed_key,
+    const std::function<bool(HandleImpl*)>& match_fn,
+    const std::function<bool(HandleImpl*)>& abort_fn) {
+  static const std::function<void(HandleImpl*)> kNoUpdate =
+      [](HandleImpl* /*h*/) {};
+  int length_bits = GetLengthBits();
+  for (;;) {
+    size_t probe = 0;
+    HandleImpl* e =
+        FindSlot(hashed_key, match_fn, abort_fn, kNoUpdate, probe, length_bits);
+    if (LIKELY(length_bits == min_length_bits_) || e != nullptr) {
+      return e;
+    }
+    // Growable table: also check older table sizes with entries remaining
+    do {
+      --length_bits;
+    } while (length_bits > min_length_bits_ &&
+             occupancy_by_length_bits_[length_bits - min_length_bits_].load(
+                 std::memory_order_relaxed) == 0);
+    if (occupancy_by_length_bits_[length_bits - min_length_bits_].load(
+            std::memory_order_relaxed) == 0) {
+      return nullptr;
+    }
+  }
+}
+
 inline void HyperClockTable::Rollback(const UniqueId64x2& hashed_key,
-                                      const HandleImpl* h) {
-  size_t current = ModTableSize(hashed_key[1]);
+                                      const HandleImpl* h, int length_bits) {
+  size_t current = ModTableSize(hashed_key[1], length_bits);
   size_t increment = static_cast<size_t>(hashed_key[0]) | 1U;
   while (&array_[current] != h) {
     array_[current].displacements.fetch_sub(1, std::memory_order_relaxed);
-    current = ModTableSize(current + increment);
+    current = ModTableSize(current + increment, length_bits);
+  }
+  if (occupancy_by_length_bits_) {
+    occupancy_by_length_bits_[length_bits - min_length_bits_].fetch_sub(
+        1, std::memory_order_relaxed);
+  }
+}
+
+void HyperClockTable::Grow(int length_bits) {
+  assert(length_bits < max_length_bits_);
+  // The new upper half of the table is already made of empty slots, and
+  // existing entries stay where they are, so we only need to publish the
+  // new size. Only one thread succeeds.
+  if (length_bits_.compare_exchange_strong(length_bits, length_bits + 1,
+                                           std::memory_order_acq_rel)) {
+    occupancy_limit_.store(
+        static_cast<size_t>((uint64_t{2} << length_bits) * kStrictLoadFactor),
+        std::memory_order_relaxed);
+    if (charge_metadata_) {
+      usage_.fetch_add((size_t{1} << length_bits) * sizeof(HandleImpl),
+                       std::memory_order_relaxed);
+    }
   }
 }
 
@@ -992,18 +1119,20 @@ inline void HyperClockTable::Evict(size_t requested_charge,
   // In other words, this eviction run must find something/anything that is
   // unreferenced at start of and during the eviction run that isn't reclaimed
   // by a concurrent eviction run.
+  const int length_bits = GetLengthBits();
   uint64_t max_clock_pointer =
-      old_clock_pointer + (ClockHandle::kMaxCountdown << length_bits_);
+      old_clock_pointer + (ClockHandle::kMaxCountdown << length_bits);
 
   // For key reconstructed from hash
   UniqueId64x2 unhashed;
 
   for (;;) {
     for (size_t i = 0; i < step_size; i++) {
-      HandleImpl& h = array_[ModTableSize(Lower32of64(old_clock_pointer + i))];
+      HandleImpl& h = array_[ModTableSize(Lower32of64(old_clock_pointer + i),
+                                          length_bits)];
       bool evicting = ClockUpdate(h);
       if (evicting) {
-        Rollback(h.hashed_key, &h);
+        Rollback(h.hashed_key, &h, h.length_bits);
         *freed_charge += h.GetTotalCharge();
         *freed_count += 1;
         bool took_ownership = false;
@@ -1065,7 +1194,7 @@ void ClockCacheShard<Table>::ApplyToSomeEntries(
   // nicely even if we resize between calls because we use upper-most
   // hash bits for table indexes.
   size_t length_bits = table_.GetLengthBits();
-  size_t length = table_.GetTableSize();
+  size_t length = size_t{1} << length_bits;
 
   assert(average_entries_per_lock > 0);
   // Assuming we are called with same average_entries_per_lock repeatedly,
@@ -1286,19 +1415,32 @@ HyperClockCache::HyperClockCache(
     size_t capacity, size_t estimated_value_size, int num_shard_bits,
     bool strict_capacity_limit,
     CacheMetadataChargePolicy metadata_charge_policy,
-    std::shared_ptr<MemoryAllocator> memory_allocator)
+    std::shared_ptr<MemoryAllocator> memory_allocator, bool numa_aware)
     : ShardedCache(capacity, num_shard_bits, strict_capacity_limit,
-                   std::move(memory_allocator)) {
-  assert(estimated_value_size > 0 ||
-         metadata_charge_policy != kDontChargeCacheMetadata);
+                   std::move(memory_allocator)),
+      growable_(estimated_value_size == 0) {
   // TODO: should not need to go through two levels of pointer indirection to
   // get to table entries
   size_t per_shard = GetPerShardCapacity();
   MemoryAllocator* alloc = this->memory_allocator();
   const Cache::EvictionCallback* eviction_callback = &eviction_callback_;
-  InitShards([=](Shard* cs) {
+  int num_numa_nodes = 0;
+#ifdef NUMA
+  if (numa_aware && numa_available() != -1) {
+    num_numa_nodes = numa_num_configured_nodes();
+  }
+#else
+  (void)numa_aware;
+#endif
+  // Shards are constructed in order, so this is the index of the shard
+  uint32_t shard_index = 0;
+  InitShards([=, &shard_index](Shard* cs) {
     HyperClockTable::Opts opts;
     opts.estimated_value_size = estimated_value_size;
+    if (num_numa_nodes > 1) {
+      opts.numa_node = static_cast<int>(shard_index % num_numa_nodes);
+    }
+    ++shard_index;
     new (cs) Shard(per_shard, strict_capacity_limit, metadata_charge_policy,
                    alloc, eviction_callback, opts);
   });
@@ -1357,6 +1499,10 @@ void AddShardEvaluation(const HyperClockCache::Shard& shard,
 
 void HyperClockCache::ReportProblems(
     const std::shared_ptr<Logger>& info_log) const {
+  if (growable_) {
+    // No estimated_entry_charge to recommend changes to
+    return;
+  }
   uint32_t shard_count = GetNumShards();
   std::vector<double> predicted_load_factors;
   size_t min_recommendation = SIZE_MAX;
@@ -1472,7 +1618,8 @@ std::shared_ptr<Cache> HyperClockCacheOptions::MakeSharedCache() const {
   }
   std::shared_ptr<Cache> cache = std::make_shared<clock_cache::HyperClockCache>(
       capacity, estimated_entry_charge, my_num_shard_bits,
-      strict_capacity_limit, metadata_charge_policy, memory_allocator);
+      strict_capacity_limit, metadata_charge_policy, memory_allocator,
+      numa_aware);
   if (secondary_cache) {
     cache = std::make_shared<CacheWithSecondaryAdapter>(cache, secondary_cache);
   }
@@ -20,6 +20,7 @@
 #include "cache/sharded_cache.h"
 #include "port/lang.h"
 #include "port/malloc.h"
+#include "port/mmap.h"
 #include "port/port.h"
 #include "rocksdb/cache.h"
 #include "rocksdb/secondary_cache.h"
@@ -50,6 +51,10 @@ class ClockCacheTest;
 // * Hash table is not resizable (for lock-free efficiency) so capacity is not
 // dynamically changeable. Rely on an estimated average value (block) size for
 // space+time efficiency. (See estimated_entry_charge option details.)
+// Without an estimate (estimated_entry_charge = 0), the table instead grows
+// as needed within address space reserved for a minimum average entry charge,
+// at the cost of probing more than one region on some lookups for a while
+// after growing. (See "Growable table" below.)
 // * Insert usually does not (but might) overwrite a previous entry associated
 // with a cache key. This is OK for RocksDB uses of Cache.
 // * Only supports keys of exactly 16 bytes, which is what RocksDB uses for
@@ -304,6 +309,14 @@ constexpr double kLoadFactor = 0.7;
 // strict upper bound on the load factor.
 constexpr double kStrictLoadFactor = 0.84;
 
+// A growable table (no estimated value size) reserves space for as many slots
+// as a fixed size table for this estimated value size. With a smaller average
+// entry charge, the table fills up before the cache reaches capacity.
+constexpr size_t kMinGrowableAvgEntryCharge = 512;
+
+// A growable table starts out with (up to) this many hash bits.
+constexpr int kGrowableInitialLengthBits = 10;
+
 struct ClockHandleBasicData {
   Cache::ObjectPtr value = nullptr;
   const Cache::CacheItemHelper* helper = nullptr;
@@ -394,13 +407,20 @@ class HyperClockTable {
     // regression.
     bool standalone = false;
 
+    // The table length_bits in effect when this entry was inserted, which
+    // determines its probe sequence. (Only varies for a growable table.)
+    uint8_t length_bits = 0;
+
     inline bool IsStandalone() const { return standalone; }
 
     inline void SetStandalone() { standalone = true; }
   };  // struct HandleImpl
 
   struct Opts {
+    // 0 for a growable table
     size_t estimated_value_size;
+    // NUMA node to allocate the table on, or -1 for the default policy
+    int numa_node = -1;
   };
 
   HyperClockTable(size_t capacity, bool strict_capacity_limit,
@@ -432,15 +452,21 @@ class HyperClockTable {
 
   void EraseUnRefEntries();
 
-  size_t GetTableSize() const { return size_t{1} << length_bits_; }
+  size_t GetTableSize() const { return size_t{1} << GetLengthBits(); }
+
+  int GetLengthBits() const {
+    return length_bits_.load(std::memory_order_acquire);
+  }
 
-  int GetLengthBits() const { return length_bits_; }
+  bool IsGrowable() const { return min_length_bits_ < max_length_bits_; }
 
   size_t GetOccupancy() const {
     return occupancy_.load(std::memory_order_relaxed);
   }
 
-  size_t GetOccupancyLimit() const { return occupancy_limit_; }
+  size_t GetOccupancyLimit() const {
+    return occupancy_limit_.load(std::memory_order_relaxed);
+  }
 
   size_t GetUsage() const { return usage_.load(std::memory_order_relaxed); }
 
@@ -453,11 +479,15 @@ class HyperClockTable {
   void TEST_ReleaseN(HandleImpl* handle, size_t n);
 
  private:  // functions
-  // Returns x mod 2^{length_bits_}.
-  inline size_t ModTableSize(uint64_t x) {
-    return static_cast<size_t>(x) & length_bits_mask_;
+  // Returns x mod 2^{length_bits}.
+  static inline size_t ModTableSize(uint64_t x, int length_bits) {
+    return static_cast<size_t>(x) & ((size_t{1} << length_bits) - 1);
   }
 
+  // For a growable table, doubles the table size unless the table has
+  // already grown from length_bits, or reached max_length_bits_.
+  void Grow(int length_bits);
+
   // Runs the clock eviction algorithm trying to reclaim at least
   // requested_charge. Returns how much is evicted, which could be less
   // if it appears impossible to evict the requested amount without blocking.
@@ -474,16 +504,26 @@ class HyperClockTable {
   // e is aborting if match(e) is false and abort(e) is true. Then the final
   // value of probe is one more than the last non-aborting probe during the
   // call. This is so that that the variable can be used to keep track of
-  // progress across consecutive calls to FindSlot.
+  // progress across consecutive calls to FindSlot. The probe sequence is the
+  // one for a table of the given length_bits.
   inline HandleImpl* FindSlot(const UniqueId64x2& hashed_key,
-                              std::function<bool(HandleImpl*)> match,
-                              std::function<bool(HandleImpl*)> stop,
-                              std::function<void(HandleImpl*)> update,
-                              size_t& probe);
-
-  // Re-decrement all displacements in probe path starting from beginning
-  // until (not including) the given handle
-  inline void Rollback(const UniqueId64x2& hashed_key, const HandleImpl* h);
+                              const std::function<bool(HandleImpl*)>& match,
+                              const std::function<bool(HandleImpl*)>& stop,
+                              const std::function<void(HandleImpl*)>& update,
+                              size_t& probe, int length_bits);
+
+  // Calls FindSlot for the probe sequence of each table size that might hold
+  // entries: the current one first, then any older (smaller) ones of a
+  // growable table. For lookups that do not insert.
+  inline HandleImpl* FindSlotAnySize(
+      const UniqueId64x2& hashed_key,
+      const std::function<bool(HandleImpl*)>& match,
+      const std::function<bool(HandleImpl*)>& stop);
+
+  // Re-decrement all displacements in probe path (for the given length_bits)
+  // starting from beginning until (not including) the given handle
+  inline void Rollback(const UniqueId64x2& hashed_key, const HandleImpl* h,
+                       int length_bits);
 
   // Subtracts `total_charge` from `usage_` and 1 from `occupancy_`.
   // Ideally this comes after releasing the entry itself so that we
@@ -527,18 +567,50 @@ class HyperClockTable {
                           CacheMetadataChargePolicy metadata_charge_policy);
 
  private:  // data
+  // Growable table
+  // --------------
+  // Without an estimated value size, the table starts small and doubles
+  // whenever occupancy reaches kLoadFactor, up to a maximum size computed for
+  // kMinGrowableAvgEntryCharge. The maximum size is reserved up front as
+  // lazily zeroed memory (an all-zero HandleImpl is an empty slot), so
+  // growing never moves entries and needs no locking: it just publishes a
+  // larger length_bits_. Each entry remembers the length_bits it was inserted
+  // with, and lookups probe the sequence for each table size that still has
+  // entries, newest first. Entries from older sizes are eventually replaced
+  // through eviction, after which lookups only probe once again.
+
+  // Largest and smallest number of hash bits (equal for a fixed size table)
+  const int max_length_bits_;
+  const int min_length_bits_;
+
   // Number of hash bits used for table index.
   // The size of the table is 1 << length_bits_.
-  const int length_bits_;
-
-  // For faster computation of ModTableSize.
-  const size_t length_bits_mask_;
+  std::atomic<int> length_bits_;
 
   // Maximum number of elements the user can store in the table.
-  const size_t occupancy_limit_;
+  std::atomic<size_t> occupancy_limit_;
+
+  // Whether table slots are charged to usage_
+  const bool charge_metadata_;
+
+  // For a growable table, number of entries inserted with each length_bits,
+  // indexed by length_bits - min_length_bits_.
+  std::unique_ptr<std::atomic<size_t>[]> occupancy_by_length_bits_;
+
+  // Frees array_, which might have been allocated on a specific NUMA node or
+  // mapped lazily for a growable table.
+  struct ArrayDeleter {
+    size_t numa_alloc_size = 0;
+    std::unique_ptr<MemMapping> lazy_mapping;
+    void operator()(HandleImpl* array) const;
+  };
+
+  static std::unique_ptr<HandleImpl[], ArrayDeleter> NewArray(size_t length,
+                                                              int numa_node,
+                                                              bool lazy);
 
   // Array of slots comprising the hash table.
-  const std::unique_ptr<HandleImpl[]> array_;
+  const std::unique_ptr<HandleImpl[], ArrayDeleter> array_;
 
   // From Cache, for deleter
   MemoryAllocator* const allocator_;
@@ -685,7 +757,8 @@ class HyperClockCache
   HyperClockCache(size_t capacity, size_t estimated_value_size,
                   int num_shard_bits, bool strict_capacity_limit,
                   CacheMetadataChargePolicy metadata_charge_policy,
-                  std::shared_ptr<MemoryAllocator> memory_allocator);
+                  std::shared_ptr<MemoryAllocator> memory_allocator,
+                  bool numa_aware = false);
 
   const char* Name() const override { return "HyperClockCache"; }
 
@@ -697,6 +770,10 @@ class HyperClockCache
 
   void ReportProblems(
       const std::shared_ptr<Logger>& /*info_log*/) const override;
+
+ private:
+  // Whether shard tables grow as needed (no estimated_value_size)
+  const bool growable_;
 };  // class HyperClockCache
 
 }  // namespace clock_cache
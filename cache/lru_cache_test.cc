@@ -884,6 +884,86 @@ TEST_F(ClockCacheTest, TableSizesTest) {
   }
 }
 
+TEST_F(ClockCacheTest, GrowableTableTest) {
+  for (auto policy : {kDontChargeCacheMetadata, kFullChargeCacheMetadata}) {
+    SCOPED_TRACE("policy = " + std::to_string(policy));
+    constexpr size_t kCapacity = 16 << 20;
+    auto cache = HyperClockCacheOptions(
+                     kCapacity, /*estimated_entry_charge*/ 0,
+                     /*num_shard_bits*/ 0, /*strict_capacity_limit*/ false,
+                     /*memory_allocator*/ nullptr, policy)
+                     .MakeSharedCache();
+    size_t initial_table_size = cache->GetTableAddressCount();
+    EXPECT_EQ(initial_table_size, size_t{1} << kGrowableInitialLengthBits);
+    size_t initial_usage = cache->GetUsage();
+
+    // Many small entries, so the table has to grow to hold them
+    constexpr size_t kCount = 10000;
+    constexpr size_t kCharge = 100;
+    std::string key(16, 'x');
+    for (uint32_t i = 0; i < kCount; ++i) {
+      EncodeFixed32(&key[0], i);
+      ASSERT_OK(cache->Insert(key, nullptr, &kNoopCacheItemHelper, kCharge));
+    }
+    size_t table_size = cache->GetTableAddressCount();
+    EXPECT_GE(table_size, kCount / kLoadFactor);
+    EXPECT_LE(table_size, kCount / kLoadFactor * 2);
+    EXPECT_EQ(cache->GetUsage(),
+              kCount * kCharge + initial_usage * table_size /
+                                     initial_table_size);
+
+    // Everything is still there, even entries inserted before growing
+    for (uint32_t i = 0; i < kCount; ++i) {
+      EncodeFixed32(&key[0], i);
+      Cache::Handle* h = cache->Lookup(key);
+      ASSERT_NE(h, nullptr);
+      cache->Release(h, /*erase_if_last_ref*/ i % 2 == 0);
+    }
+    for (uint32_t i = 0; i < kCount; ++i) {
+      EncodeFixed32(&key[0], i);
+      Cache::Handle* h = cache->Lookup(key);
+      if (i % 2 == 0) {
+        ASSERT_EQ(h, nullptr);
+      } else {
+        ASSERT_NE(h, nullptr);
+        cache->Release(h);
+        cache->Erase(key);
+        ASSERT_EQ(cache->Lookup(key), nullptr);
+      }
+    }
+    EXPECT_EQ(cache->GetUsage(), initial_usage * table_size /
+                                     initial_table_size);
+  }
+}
+
+TEST_F(ClockCacheTest, NumaAwareTest) {
+  // Whether or not NUMA is available, the option must not change behavior
+  HyperClockCacheOptions opts(
+      /*capacity*/ 64 << 10, /*estimated_entry_charge*/ 1024,
+      /*num_shard_bits*/ 2, /*strict_capacity_limit*/ false,
+      /*memory_allocator*/ nullptr, kDontChargeCacheMetadata);
+  auto cache = opts.MakeSharedCache();
+  opts.numa_aware = true;
+  auto numa_cache = opts.MakeSharedCache();
+  EXPECT_EQ(numa_cache->GetTableAddressCount(),
+            cache->GetTableAddressCount());
+
+  std::string key(16, 'x');
+  for (char c = 'a'; c <= 'z'; ++c) {
+    key[0] = c;
+    ASSERT_OK(
+        numa_cache->Insert(key, nullptr, &kNoopCacheItemHelper, /*charge*/ 1));
+  }
+  EXPECT_EQ(numa_cache->GetUsage(), 26U);
+  for (char c = 'a'; c <= 'z'; ++c) {
+    key[0] = c;
+    Cache::Handle* h = numa_cache->Lookup(key);
+    ASSERT_NE(h, nullptr);
+    numa_cache->Release(h, /*erase_if_last_ref*/ c % 2 == 0);
+  }
+  EXPECT_EQ(numa_cache->GetUsage(), 13U);
+}
+
 }  // namespace clock_cache
 
 class TestSecondaryCache : public SecondaryCache {
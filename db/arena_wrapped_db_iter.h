@@ -74,6 +74,9 @@ class ArenaWrappedDBIter : public Iterator {
   Slice value() const override { return db_iter_->value(); }
   const WideColumns& columns() const override { return db_iter_->columns(); }
   Status status() const override { return db_iter_->status(); }
+  Status NextBatch(size_t max_entries, KeyValueBatch* batch) override {
+    return db_iter_->NextBatch(max_entries, batch);
+  }
   Slice timestamp() const override { return db_iter_->timestamp(); }
   bool IsBlob() const { return db_iter_->IsBlob(); }
 
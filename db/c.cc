@@ -99,6 +99,7 @@ using ROCKSDB_NAMESPACE::Options;
 using ROCKSDB_NAMESPACE::PerfContext;
 using ROCKSDB_NAMESPACE::PerfLevel;
 using ROCKSDB_NAMESPACE::PinnableSlice;
+using ROCKSDB_NAMESPACE::PinnableWideColumns;
 using ROCKSDB_NAMESPACE::PrepopulateBlobCache;
 using ROCKSDB_NAMESPACE::RandomAccessFile;
 using ROCKSDB_NAMESPACE::Range;
@@ -250,6 +251,13 @@ struct rocksdb_perfcontext_t {
 struct rocksdb_pinnableslice_t {
   PinnableSlice rep;
 };
+struct rocksdb_pinnableslices_t {
+  std::vector<PinnableSlice> values;
+  std::vector<Status> statuses;
+};
+struct rocksdb_pinnableentities_t {
+  std::vector<PinnableWideColumns> entities;
+};
 struct rocksdb_transactiondb_options_t {
   TransactionDBOptions rep;
 };
@@ -1495,6 +1503,62 @@ void rocksdb_batched_multi_get_cf(rocksdb_t* db,
   delete[] statuses;
 }
 
+rocksdb_pinnableslices_t* rocksdb_batched_multi_get_pinned_cf(
+    rocksdb_t* db, const rocksdb_readoptions_t* options,
+    rocksdb_column_family_handle_t* column_family, size_t num_keys,
+    const char* const* keys_list, const size_t* keys_list_sizes, char** errs,
+    const bool sorted_input) {
+  std::vector<Slice> keys(num_keys);
+  for (size_t i = 0; i < num_keys; ++i) {
+    keys[i] = Slice(keys_list[i], keys_list_sizes[i]);
+  }
+  rocksdb_pinnableslices_t* result = new rocksdb_pinnableslices_t;
+  result->values.resize(num_keys);
+  result->statuses.resize(num_keys);
+
+  db->rep->MultiGet(options->rep, column_family->rep, num_keys, keys.data(),
+                    result->values.data(), result->statuses.data(),
+                    sorted_input);
+
+  for (size_t i = 0; i < num_keys; ++i) {
+    const Status& s = result->statuses[i];
+    if (s.ok() || s.IsNotFound()) {
+      errs[i] = nullptr;
+    } else {
+      errs[i] = strdup(s.ToString().c_str());
+    }
+  }
+  return result;
+}
+
+rocksdb_pinnableentities_t* rocksdb_batched_multi_get_entity_cf(
+    rocksdb_t* db, const rocksdb_readoptions_t* options,
+    rocksdb_column_family_handle_t* column_family, size_t num_keys,
+    const char* const* keys_list, const size_t* keys_list_sizes, char** errs,
+    const bool sorted_input) {
+  std::vector<Slice> keys(num_keys);
+  for (size_t i = 0; i < num_keys; ++i) {
+    keys[i] = Slice(keys_list[i], keys_list_sizes[i]);
+  }
+  std::vector<Status> statuses(num_keys);
+  rocksdb_pinnableentities_t* result = new rocksdb_pinnableentities_t;
+  result->entities.resize(num_keys);
+
+  db->rep->MultiGetEntity(options->rep, column_family->rep, num_keys,
+                          keys.data(), result->entities.data(),
+                          statuses.data(), sorted_input);
+
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (statuses[i].ok() || statuses[i].IsNotFound()) {
+      errs[i] = nullptr;
+    } else {
+      result->entities[i].Reset();
+      errs[i] = strdup(statuses[i].ToString().c_str());
+    }
+  }
+  return result;
+}
+
 unsigned char rocksdb_key_may_exist(rocksdb_t* db,
                                     const rocksdb_readoptions_t* options,
                                     const char* key, size_t key_len,
@@ -6430,6 +6494,48 @@ const char* rocksdb_pinnableslice_value(const rocksdb_pinnableslice_t* v,
   return v->rep.data();
 }
 
+void rocksdb_pinnableslices_destroy(rocksdb_pinnableslices_t* v) { delete v; }
+
+const char* rocksdb_pinnableslices_value(const rocksdb_pinnableslices_t* v,
+                                         size_t index, size_t* vlen) {
+  assert(index < v->values.size());
+  if (!v->statuses[index].ok()) {
+    *vlen = 0;
+    return nullptr;
+  }
+
+  *vlen = v->values[index].size();
+  return v->values[index].data();
+}
+
+void rocksdb_pinnableentities_destroy(rocksdb_pinnableentities_t* v) {
+  delete v;
+}
+
+size_t rocksdb_pinnableentities_num_columns(
+    const rocksdb_pinnableentities_t* v, size_t index) {
+  assert(index < v->entities.size());
+  return v->entities[index].columns().size();
+}
+
+const char* rocksdb_pinnableentities_column_name(
+    const rocksdb_pinnableentities_t* v, size_t index, size_t column,
+    size_t* name_len) {
+  assert(column < rocksdb_pinnableentities_num_columns(v, index));
+  const Slice& name = v->entities[index].columns()[column].name();
+  *name_len = name.size();
+  return name.data();
+}
+
+const char* rocksdb_pinnableentities_column_value(
+    const rocksdb_pinnableentities_t* v, size_t index, size_t column,
+    size_t* value_len) {
+  assert(column < rocksdb_pinnableentities_num_columns(v, index));
+  const Slice& value = v->entities[index].columns()[column].value();
+  *value_len = value.size();
+  return value.data();
+}
+
 // container to keep databases and caches in order to use
 // ROCKSDB_NAMESPACE::MemoryUtil
 struct rocksdb_memory_consumers_t {
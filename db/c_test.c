@@ -1581,6 +1581,37 @@ int main(int argc, char** argv) {
         CheckEqual(expected_value[i], val, val_len);
         rocksdb_pinnableslice_destroy(pvals[i]);
       }
+
+      rocksdb_pinnableslices_t* pinned = rocksdb_batched_multi_get_pinned_cf(
+          db, roptions, handles[1], 4, batched_keys, batched_keys_sizes,
+          batched_errs, false);
+      for (i = 0; i < 4; ++i) {
+        CheckNoError(batched_errs[i]);
+        val = rocksdb_pinnableslices_value(pinned, i, &val_len);
+        CheckEqual(expected_value[i], val, val_len);
+      }
+      rocksdb_pinnableslices_destroy(pinned);
+
+      rocksdb_pinnableentities_t* entities =
+          rocksdb_batched_multi_get_entity_cf(db, roptions, handles[1], 4,
+                                              batched_keys, batched_keys_sizes,
+                                              batched_errs, false);
+      for (i = 0; i < 4; ++i) {
+        CheckNoError(batched_errs[i]);
+        if (expected_value[i] == NULL) {
+          CheckCondition(rocksdb_pinnableentities_num_columns(entities, i) ==
+                         0);
+          continue;
+        }
+        // Plain values come back as a single anonymous column
+        CheckCondition(rocksdb_pinnableentities_num_columns(entities, i) ==
+                       1);
+        val = rocksdb_pinnableentities_column_name(entities, i, 0, &val_len);
+        CheckCondition(val_len == 0);
+        val = rocksdb_pinnableentities_column_value(entities, i, 0, &val_len);
+        CheckEqual(expected_value[i], val, val_len);
+      }
+      rocksdb_pinnableentities_destroy(entities);
     }
 
     {
@@ -273,6 +273,12 @@ ColumnFamilyOptions SanitizeOptions(const ImmutableDBOptions& db_options,
     result.memtable_prefix_bloom_size_ratio = 0;
   }
 
+  if (result.memtable_hash_index_size_ratio > 0.25) {
+    result.memtable_hash_index_size_ratio = 0.25;
+  } else if (result.memtable_hash_index_size_ratio < 0) {
+    result.memtable_hash_index_size_ratio = 0;
+  }
+
   if (!result.prefix_extractor) {
     assert(result.memtable_factory);
     Slice name = result.memtable_factory->Name();
@@ -552,6 +558,7 @@ ColumnFamilyData::ColumnFamilyData(
       queued_for_flush_(false),
       queued_for_compaction_(false),
       prev_compaction_needed_bytes_(0),
+      prev_write_stall_progress_(0),
       allow_2pc_(db_options.allow_2pc),
       last_memtable_id_(0),
       db_paths_registered_(false),
@@ -770,6 +777,9 @@ const double kIncSlowdownRatio = 0.8;
 const double kDecSlowdownRatio = 1 / kIncSlowdownRatio;
 const double kNearStopSlowdownRatio = 0.6;
 const double kDelayRecoverSlowdownRatio = 1.4;
+// Delayed write rate ratio reached by write_throttle_start_ratio at the
+// write slowdown triggers
+const double kEarlyThrottleMinRateRatio = 0.5;
 
 namespace {
 // If penalize_stop is true, we further reduce slowdown rate.
@@ -836,6 +846,43 @@ std::unique_ptr<WriteControllerToken> SetupDelay(
   return write_controller->GetDelayToken(write_rate);
 }
 
+// Returns how far the column family is on its way to the nearest write
+// slowdown trigger, where 0 means no flush or compaction debt and 1 means the
+// trigger is reached. See write_throttle_start_ratio.
+double GetWriteStallProgress(int num_unflushed_memtables, int num_l0_files,
+                             uint64_t num_compaction_needed_bytes,
+                             const MutableCFOptions& mutable_cf_options,
+                             const ImmutableCFOptions& immutable_cf_options) {
+  double progress = 0;
+  // Mirrors the delay and stop conditions in GetWriteStallConditionAndCause()
+  int memtable_trigger = mutable_cf_options.max_write_buffer_number > 3
+                             ? mutable_cf_options.max_write_buffer_number - 1
+                             : mutable_cf_options.max_write_buffer_number;
+  int memtable_base = immutable_cf_options.min_write_buffer_number_to_merge;
+  if (memtable_trigger > memtable_base) {
+    progress = std::max(
+        progress, static_cast<double>(num_unflushed_memtables - memtable_base) /
+                      (memtable_trigger - memtable_base));
+  }
+  if (mutable_cf_options.disable_auto_compactions) {
+    return progress;
+  }
+  int l0_base = mutable_cf_options.level0_file_num_compaction_trigger;
+  int l0_trigger = mutable_cf_options.level0_slowdown_writes_trigger;
+  if (l0_base >= 0 && l0_trigger > l0_base) {
+    progress = std::max(progress, static_cast<double>(num_l0_files - l0_base) /
+                                      (l0_trigger - l0_base));
+  }
+  if (mutable_cf_options.soft_pending_compaction_bytes_limit > 0) {
+    progress = std::max(
+        progress,
+        static_cast<double>(num_compaction_needed_bytes) /
+            static_cast<double>(
+                mutable_cf_options.soft_pending_compaction_bytes_limit));
+  }
+  return progress;
+}
+
 int GetL0ThresholdSpeedupCompaction(int level0_file_num_compaction_trigger,
                                     int level0_slowdown_writes_trigger) {
   // SanitizeOptions() ensures it.
@@ -926,6 +973,17 @@ WriteStallCondition ColumnFamilyData::RecalculateWriteStallConditions(
     bool was_stopped = write_controller->IsStopped();
     bool needed_delay = write_controller->NeedsDelay();
 
+    // Extrapolate the progress towards the slowdown triggers by its last
+    // change, so that debt that grows quickly is throttled earlier.
+    double write_stall_progress = GetWriteStallProgress(
+        imm()->NumNotFlushed(), vstorage->l0_delay_trigger_count(),
+        compaction_needed_bytes, mutable_cf_options, *ioptions());
+    double predicted_write_stall_progress =
+        write_stall_progress +
+        std::max(0.0, write_stall_progress - prev_write_stall_progress_);
+    prev_write_stall_progress_ = write_stall_progress;
+    const double throttle_start = mutable_cf_options.write_throttle_start_ratio;
+
     if (write_stall_condition == WriteStallCondition::kStopped &&
         write_stall_cause == WriteStallCause::kMemtableLimit) {
       write_controller_token_ = write_controller->GetStopToken();
@@ -1021,10 +1079,39 @@ WriteStallCondition ColumnFamilyData::RecalculateWriteStallConditions(
           write_controller->delayed_write_rate());
     } else {
       assert(write_stall_condition == WriteStallCondition::kNormal);
-      if (vstorage->l0_delay_trigger_count() >=
-          GetL0ThresholdSpeedupCompaction(
-              mutable_cf_options.level0_file_num_compaction_trigger,
-              mutable_cf_options.level0_slowdown_writes_trigger)) {
+      bool early_throttle = throttle_start > 0 && throttle_start < 1 &&
+                            predicted_write_stall_progress > throttle_start;
+      if (early_throttle) {
+        // Slow down linearly from the max delayed write rate at the start
+        // ratio to kEarlyThrottleMinRateRatio of it at the triggers. When
+        // recovering from a delay, do not speed up faster than the regular
+        // recovery does.
+        double distance = std::min(
+            1.0, (predicted_write_stall_progress - throttle_start) /
+                     (1 - throttle_start));
+        double max_write_rate =
+            static_cast<double>(write_controller->max_delayed_write_rate());
+        double write_rate =
+            max_write_rate * (1 - distance * (1 - kEarlyThrottleMinRateRatio));
+        if (needed_delay) {
+          write_rate = std::min(
+              write_rate,
+              static_cast<double>(write_controller->delayed_write_rate()) *
+                  kDelayRecoverSlowdownRatio);
+        }
+        write_controller_token_ =
+            write_controller->GetDelayToken(static_cast<uint64_t>(write_rate));
+        ROCKS_LOG_INFO(
+            ioptions_.logger,
+            "[%s] Throttling writes ahead of write stall, progress %.2f "
+            "predicted %.2f rate %" PRIu64,
+            name_.c_str(), write_stall_progress,
+            predicted_write_stall_progress,
+            write_controller->delayed_write_rate());
+      } else if (vstorage->l0_delay_trigger_count() >=
+                 GetL0ThresholdSpeedupCompaction(
+                     mutable_cf_options.level0_file_num_compaction_trigger,
+                     mutable_cf_options.level0_slowdown_writes_trigger)) {
         write_controller_token_ =
             write_controller->GetCompactionPressureToken();
         ROCKS_LOG_INFO(
@@ -1054,7 +1141,7 @@ WriteStallCondition ColumnFamilyData::RecalculateWriteStallConditions(
       // If the DB recovers from delay conditions, we reward with reducing
       // double the slowdown ratio. This is to balance the long term slowdown
       // increase signal.
-      if (needed_delay) {
+      if (needed_delay && !early_throttle) {
         uint64_t write_rate = write_controller->delayed_write_rate();
         write_controller->set_delayed_write_rate(static_cast<uint64_t>(
             static_cast<double>(write_rate) * kDelayRecoverSlowdownRatio));
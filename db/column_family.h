@@ -621,6 +621,10 @@ class ColumnFamilyData {
 
   uint64_t prev_compaction_needed_bytes_;
 
+  // Progress towards the write slowdown triggers seen by the last
+  // RecalculateWriteStallConditions(), for write_throttle_start_ratio
+  double prev_write_stall_progress_;
+
   // if the database was opened with 2pc enabled
   bool allow_2pc_;
 
@@ -1611,6 +1611,102 @@ TEST_P(DBMultiGetTestWithParam, MultiGetBatchedSimpleUnsorted) {
   } while (ChangeCompactOptions());
 }
 
+TEST_P(DBMultiGetTestWithParam, MultiGetBatchedParallel) {
+#ifndef USE_COROUTINES
+  if (std::get<1>(GetParam())) {
+    ROCKSDB_GTEST_SKIP("This test requires coroutine support");
+    return;
+  }
+#endif  // USE_COROUTINES
+  // Skip for unbatched MultiGet
+  if (!std::get<0>(GetParam())) {
+    ROCKSDB_GTEST_BYPASS("This test is only for batched MultiGet");
+    return;
+  }
+  Options options = CurrentOptions();
+  options.disable_auto_compactions = true;
+  Reopen(options);
+
+  // Older values in L2, overwrites, deletes and a range deletion in L1, and
+  // some more in the memtable, so that precedence matters.
+  const int kNumKeys = 300;
+  for (int i = 0; i < kNumKeys; ++i) {
+    ASSERT_OK(Put(Key(i), "old" + std::to_string(i)));
+  }
+  ASSERT_OK(Flush());
+  MoveFilesToLevel(2);
+  for (int i = 0; i < kNumKeys; i += 3) {
+    ASSERT_OK(Put(Key(i), "new" + std::to_string(i)));
+  }
+  for (int i = 1; i < kNumKeys; i += 7) {
+    ASSERT_OK(Delete(Key(i)));
+  }
+  ASSERT_OK(db_->DeleteRange(WriteOptions(), db_->DefaultColumnFamily(),
+                             Key(100), Key(150)));
+  ASSERT_OK(Flush());
+  MoveFilesToLevel(1);
+  for (int i = 0; i < kNumKeys; i += 10) {
+    ASSERT_OK(Put(Key(i), "mem" + std::to_string(i)));
+  }
+
+  // Unsorted, with one key that was never written
+  std::vector<int> key_ints;
+  for (int i = kNumKeys - 1; i >= 0; --i) {
+    key_ints.push_back(i);
+  }
+  key_ints.push_back(kNumKeys);
+  std::vector<std::string> key_strs;
+  for (int i : key_ints) {
+    key_strs.push_back(Key(i));
+  }
+  std::vector<Slice> keys(key_strs.begin(), key_strs.end());
+
+  std::atomic<int> helper_count{0};
+  SyncPoint::GetInstance()->SetCallBack(
+      "DBImpl::MultiGetBatchesInParallel:Helper",
+      [&](void* /*arg*/) { helper_count.fetch_add(1); });
+  SyncPoint::GetInstance()->EnableProcessing();
+
+  std::vector<std::vector<PinnableSlice>> values;
+  std::vector<std::vector<Status>> statuses;
+  for (size_t parallelism : {1, 4}) {
+    ReadOptions ro;
+    ro.async_io = std::get<1>(GetParam());
+    ro.multiget_parallelism = parallelism;
+    values.emplace_back(keys.size());
+    statuses.emplace_back(keys.size());
+    db_->MultiGet(ro, db_->DefaultColumnFamily(), keys.size(), keys.data(),
+                  values.back().data(), statuses.back().data());
+  }
+  SyncPoint::GetInstance()->DisableProcessing();
+  SyncPoint::GetInstance()->ClearAllCallBacks();
+  EXPECT_EQ(helper_count.load(), 3);
+
+  for (size_t k = 0; k < keys.size(); ++k) {
+    int i = key_ints[k];
+    std::string expected;
+    if (i < kNumKeys) {
+      if (i % 10 == 0) {
+        expected = "mem" + std::to_string(i);
+      } else if ((i >= 100 && i < 150) || i % 7 == 1) {
+        // Deleted
+      } else if (i % 3 == 0) {
+        expected = "new" + std::to_string(i);
+      } else {
+        expected = "old" + std::to_string(i);
+      }
+    }
+    for (size_t j = 0; j < values.size(); ++j) {
+      if (expected.empty()) {
+        ASSERT_TRUE(statuses[j][k].IsNotFound()) << j << " " << k;
+      } else {
+        ASSERT_OK(statuses[j][k]);
+        ASSERT_EQ(values[j][k], expected);
+      }
+    }
+  }
+}
+
 TEST_P(DBMultiGetTestWithParam, MultiGetBatchedSortedMultiFile) {
 #ifndef USE_COROUTINES
   if (std::get<1>(GetParam())) {
@@ -2549,6 +2549,56 @@ TEST_F(DBFlushTest, TombstoneVisibleInSnapshot) {
   db_->ReleaseSnapshot(snapshot);
 }
 
+TEST_F(DBFlushTest, PartitionedFlush) {
+  Options options = CurrentOptions();
+  options.max_flush_partitions = 4;
+  options.write_buffer_size = 64 << 20;
+  options.disable_auto_compactions = true;
+  DestroyAndReopen(options);
+
+  const int kNumKeys = 6000;
+  Random rnd(301);
+  std::vector<std::string> values;
+  for (int i = 0; i < kNumKeys; i++) {
+    values.push_back(rnd.RandomString(1000));
+    ASSERT_OK(Put(Key(i), values.back()));
+  }
+  ASSERT_OK(Flush());
+
+  // The flush output is split into several level-0 files with disjoint key
+  // ranges.
+  std::vector<LiveFileMetaData> files;
+  db_->GetLiveFilesMetaData(&files);
+  ASSERT_GT(files.size(), 1U);
+  ASSERT_LE(files.size(), 4U);
+  std::sort(files.begin(), files.end(),
+            [](const LiveFileMetaData& a, const LiveFileMetaData& b) {
+              return a.smallestkey < b.smallestkey;
+            });
+  for (size_t i = 0; i < files.size(); i++) {
+    ASSERT_EQ(0, files[i].level);
+    if (i > 0) {
+      ASSERT_LT(files[i - 1].largestkey, files[i].smallestkey);
+    }
+  }
+
+  for (int reopen = 0; reopen < 2; reopen++) {
+    for (int i = 0; i < kNumKeys; i++) {
+      ASSERT_EQ(values[i], Get(Key(i)));
+    }
+    Reopen(options);
+  }
+
+  // Range deletions are always flushed into a single file
+  ASSERT_OK(db_->DeleteRange(WriteOptions(), db_->DefaultColumnFamily(),
+                             Key(0), Key(10)));
+  for (int i = 0; i < kNumKeys; i++) {
+    ASSERT_OK(Put(Key(i), values[i]));
+  }
+  ASSERT_OK(Flush());
+  ASSERT_EQ(static_cast<int>(files.size()) + 1, NumTableFilesAtLevel(0));
+}
+
 TEST_P(DBAtomicFlushTest, ManualFlushUnder2PC) {
   Options options = CurrentOptions();
   options.create_if_missing = true;
@@ -51,6 +51,7 @@
 #include "db/table_properties_collector.h"
 #include "db/transaction_log_impl.h"
 #include "db/version_set.h"
+#include "db/wide/wide_column_serialization.h"
 #include "db/write_batch_internal.h"
 #include "db/write_callback.h"
 #include "env/unique_id_gen.h"
@@ -106,6 +107,7 @@
 #include "util/mutexlock.h"
 #include "util/stop_watch.h"
 #include "util/string_util.h"
+#include "util/threadpool_imp.h"
 #include "utilities/trace/replayer_impl.h"
 
 namespace ROCKSDB_NAMESPACE {
@@ -566,6 +568,10 @@ Status DBImpl::CloseHelper() {
   if (HasPendingManualCompaction()) {
     DisableManualCompaction();
   }
+  if (multiget_thread_pool_) {
+    // Idle unless MultiGet is (incorrectly) called concurrently with Close
+    multiget_thread_pool_->JoinAllThreads();
+  }
   mutex_.Lock();
   // Unschedule all tasks for this DB
   for (uint8_t i = 0; i < static_cast<uint8_t>(TaskType::kCount); i++) {
@@ -1442,13 +1448,28 @@ Status DBImpl::SyncWAL() {
     InstrumentedMutexLock l(&log_write_mutex_);
     assert(!logs_.empty());
 
-    // This SyncWAL() call only cares about logs up to this number.
+    // This SyncWAL() call only cares about logs up to this number, and
+    // about the data written to the current log so far.
     current_log_number = logfile_number_;
+    assert(logs_.back().number == current_log_number);
+    const uint64_t current_log_size =
+        logs_.back().writer->file()->GetFlushedSize();
 
     while (logs_.front().number <= current_log_number &&
            logs_.front().IsSyncing()) {
+      TEST_SYNC_POINT("DBImpl::SyncWAL:WaitForPendingSync");
       log_sync_cv_.Wait();
     }
+    // Group commit: if syncs that finished in the meantime (e.g. the one
+    // waited for above, by a concurrent SyncWAL() or sync write) already
+    // persisted everything up to here, there is nothing left to sync.
+    if (log_dir_synced_ &&
+        (logs_.front().number > current_log_number ||
+         (logs_.front().number == current_log_number &&
+          logs_.front().GetSyncedSize() >= current_log_size))) {
+      TEST_SYNC_POINT("DBImpl::SyncWAL:AlreadySynced");
+      return Status::OK();
+    }
     // First check that logs are safe to sync in background.
     for (auto it = logs_.begin();
          it != logs_.end() && it->number <= current_log_number; ++it) {
@@ -1632,13 +1653,13 @@ void DBImpl::MarkLogsSynced(uint64_t up_to, bool synced_dir,
         it = logs_.erase(it);
       } else {
         assert(wal.GetPreSyncSize() < wal.writer->file()->GetFlushedSize());
-        wal.FinishSync();
+        wal.FinishSync(/*synced=*/true);
         ++it;
       }
     } else {
       assert(wal.number == logs_.back().number);
       // Active WAL
-      wal.FinishSync();
+      wal.FinishSync(/*synced=*/true);
       ++it;
     }
   }
@@ -1650,7 +1671,7 @@ void DBImpl::MarkLogsNotSynced(uint64_t up_to) {
   for (auto it = logs_.begin(); it != logs_.end() && it->number <= up_to;
        ++it) {
     auto& wal = *it;
-    wal.FinishSync();
+    wal.FinishSync(/*synced=*/false);
   }
   log_sync_cv_.SignalAll();
 }
@@ -1942,7 +1963,36 @@ Status DBImpl::GetEntity(const ReadOptions& read_options,
   get_impl_options.column_family = column_family;
   get_impl_options.columns = columns;
 
-  return GetImpl(read_options, key, get_impl_options);
+  Status s = GetImpl(read_options, key, get_impl_options);
+  if (s.ok() && read_options.column_projection) {
+    s = ProjectColumns(*read_options.column_projection, columns);
+  }
+
+  return s;
+}
+
+Status DBImpl::ProjectColumns(const std::vector<Slice>& projection,
+                              PinnableWideColumns* columns) {
+  assert(columns);
+
+  WideColumns projected = columns->columns();
+  WideColumnSerialization::Project(projection, projected);
+
+  if (projected.size() == columns->columns().size()) {
+    return Status::OK();
+  }
+
+  std::string serialized;
+  const Status s = WideColumnSerialization::Serialize(projected, serialized);
+  if (!s.ok()) {
+    return s;
+  }
+
+  // `projected` points into the old value, which is only released here after
+  // the projected columns have been copied out.
+  columns->Reset();
+
+  return columns->SetWideColumnValue(std::move(serialized));
 }
 
 bool DBImpl::ShouldReferenceSuperVersion(const MergeContext& merge_context) {
@@ -2951,6 +3001,17 @@ Status DBImpl::MultiGetImpl(
   size_t keys_left = num_keys;
   Status s;
   uint64_t curr_value_size = 0;
+  size_t parallelism = std::min(
+      read_options.multiget_parallelism,
+      (num_keys - 1) / MultiGetContext::MAX_BATCH_SIZE + 1);
+  if (parallelism > 1 && callback == nullptr &&
+      read_options.value_size_soft_limit ==
+          std::numeric_limits<uint64_t>::max()) {
+    s = MultiGetBatchesInParallel(read_options, start_key, num_keys,
+                                  sorted_keys, super_version, snapshot,
+                                  parallelism);
+    keys_left = 0;
+  }
   while (keys_left) {
     if (read_options.deadline.count() &&
         immutable_db_options_.clock->NowMicros() >
@@ -2962,40 +3023,10 @@ Status DBImpl::MultiGetImpl(
     size_t batch_size = (keys_left > MultiGetContext::MAX_BATCH_SIZE)
                             ? MultiGetContext::MAX_BATCH_SIZE
                             : keys_left;
-    MultiGetContext ctx(sorted_keys, start_key + num_keys - keys_left,
-                        batch_size, snapshot, read_options, GetFileSystem(),
-                        stats_);
-    MultiGetRange range = ctx.GetMultiGetRange();
-    range.AddValueSize(curr_value_size);
-    bool lookup_current = false;
-
+    curr_value_size = MultiGetBatch(
+        read_options, start_key + num_keys - keys_left, batch_size,
+        sorted_keys, super_version, snapshot, callback, curr_value_size);
     keys_left -= batch_size;
-    for (auto mget_iter = range.begin(); mget_iter != range.end();
-         ++mget_iter) {
-      mget_iter->merge_context.Clear();
-      *mget_iter->s = Status::OK();
-    }
-
-    bool skip_memtable =
-        (read_options.read_tier == kPersistedTier &&
-         has_unpersisted_data_.load(std::memory_order_relaxed));
-    if (!skip_memtable) {
-      super_version->mem->MultiGet(read_options, &range, callback,
-                                   false /* immutable_memtable */);
-      if (!range.empty()) {
-        super_version->imm->MultiGet(read_options, &range, callback);
-      }
-      if (!range.empty()) {
-        lookup_current = true;
-        uint64_t left = range.KeysLeft();
-        RecordTick(stats_, MEMTABLE_MISS, left);
-      }
-    }
-    if (lookup_current) {
-      PERF_TIMER_GUARD(get_from_output_files_time);
-      super_version->current->MultiGet(read_options, &range, callback);
-    }
-    curr_value_size = range.GetValueSize();
     if (curr_value_size > read_options.value_size_soft_limit) {
       s = Status::Aborted();
       break;
@@ -3042,12 +3073,125 @@ Status DBImpl::MultiGetImpl(
   return s;
 }
 
+uint64_t DBImpl::MultiGetBatch(
+    const ReadOptions& read_options, size_t start_key, size_t batch_size,
+    autovector<KeyContext*, MultiGetContext::MAX_BATCH_SIZE>* sorted_keys,
+    SuperVersion* super_version, SequenceNumber snapshot,
+    ReadCallback* callback, uint64_t curr_value_size) {
+  MultiGetContext ctx(sorted_keys, start_key, batch_size, snapshot,
+                      read_options, GetFileSystem(), stats_);
+  MultiGetRange range = ctx.GetMultiGetRange();
+  range.AddValueSize(curr_value_size);
+  bool lookup_current = false;
+
+  for (auto mget_iter = range.begin(); mget_iter != range.end(); ++mget_iter) {
+    mget_iter->merge_context.Clear();
+    *mget_iter->s = Status::OK();
+  }
+
+  bool skip_memtable =
+      (read_options.read_tier == kPersistedTier &&
+       has_unpersisted_data_.load(std::memory_order_relaxed));
+  if (!skip_memtable) {
+    super_version->mem->MultiGet(read_options, &range, callback,
+                                 false /* immutable_memtable */);
+    if (!range.empty()) {
+      super_version->imm->MultiGet(read_options, &range, callback);
+    }
+    if (!range.empty()) {
+      lookup_current = true;
+      uint64_t left = range.KeysLeft();
+      RecordTick(stats_, MEMTABLE_MISS, left);
+    }
+  }
+  if (lookup_current) {
+    PERF_TIMER_GUARD(get_from_output_files_time);
+    super_version->current->MultiGet(read_options, &range, callback);
+  }
+  return range.GetValueSize();
+}
+
+Status DBImpl::MultiGetBatchesInParallel(
+    const ReadOptions& read_options, size_t start_key, size_t num_keys,
+    autovector<KeyContext*, MultiGetContext::MAX_BATCH_SIZE>* sorted_keys,
+    SuperVersion* super_version, SequenceNumber snapshot,
+    size_t parallelism) {
+  assert(parallelism > 1);
+  std::call_once(multiget_thread_pool_once_, [this]() {
+    multiget_thread_pool_.reset(new ThreadPoolImpl());
+    multiget_thread_pool_->SetHostEnv(env_);
+  });
+  multiget_thread_pool_->IncBackgroundThreadsIfNeeded(
+      static_cast<int>(parallelism - 1));
+
+  // Threads claim batches in key order until there are none left, so a
+  // thread that gets delayed does not hold up the rest of the call.
+  const size_t num_batches =
+      (num_keys - 1) / MultiGetContext::MAX_BATCH_SIZE + 1;
+  std::atomic<size_t> next_batch{0};
+  std::atomic<bool> timed_out{false};
+  auto process_batches = [&]() {
+    for (;;) {
+      size_t batch = next_batch.fetch_add(1, std::memory_order_relaxed);
+      if (batch >= num_batches) {
+        return;
+      }
+      size_t batch_start = start_key + batch * MultiGetContext::MAX_BATCH_SIZE;
+      size_t batch_size = std::min(size_t{MultiGetContext::MAX_BATCH_SIZE},
+                                   start_key + num_keys - batch_start);
+      if (read_options.deadline.count() &&
+          immutable_db_options_.clock->NowMicros() >
+              static_cast<uint64_t>(read_options.deadline.count())) {
+        timed_out.store(true, std::memory_order_relaxed);
+        for (size_t i = batch_start; i < batch_start + batch_size; ++i) {
+          *(*sorted_keys)[i]->s = Status::TimedOut();
+        }
+        continue;
+      }
+      MultiGetBatch(read_options, batch_start, batch_size, sorted_keys,
+                    super_version, snapshot, /*callback=*/nullptr,
+                    /*curr_value_size=*/0);
+    }
+  };
+
+  port::Mutex mu;
+  port::CondVar cv(&mu);
+  size_t helpers_running = parallelism - 1;
+  for (size_t i = 0; i < parallelism - 1; ++i) {
+    multiget_thread_pool_->SubmitJob([&]() {
+      TEST_SYNC_POINT("DBImpl::MultiGetBatchesInParallel:Helper");
+      process_batches();
+      MutexLock l(&mu);
+      if (--helpers_running == 0) {
+        cv.Signal();
+      }
+    });
+  }
+  process_batches();
+  {
+    MutexLock l(&mu);
+    while (helpers_running > 0) {
+      cv.Wait();
+    }
+  }
+  return timed_out.load(std::memory_order_relaxed) ? Status::TimedOut()
+                                                   : Status::OK();
+}
+
 void DBImpl::MultiGetEntity(const ReadOptions& options, size_t num_keys,
                             ColumnFamilyHandle** column_families,
                             const Slice* keys, PinnableWideColumns* results,
                             Status* statuses, bool sorted_input) {
   MultiGetCommon(options, num_keys, column_families, keys, /* values */ nullptr,
                  results, /* timestamps */ nullptr, statuses, sorted_input);
+
+  if (options.column_projection) {
+    for (size_t i = 0; i < num_keys; ++i) {
+      if (statuses[i].ok()) {
+        statuses[i] = ProjectColumns(*options.column_projection, &results[i]);
+      }
+    }
+  }
 }
 
 void DBImpl::MultiGetEntity(const ReadOptions& options,
@@ -3056,6 +3200,14 @@ void DBImpl::MultiGetEntity(const ReadOptions& options,
                             Status* statuses, bool sorted_input) {
   MultiGetCommon(options, column_family, num_keys, keys, /* values */ nullptr,
                  results, /* timestamps */ nullptr, statuses, sorted_input);
+
+  if (options.column_projection) {
+    for (size_t i = 0; i < num_keys; ++i) {
+      if (statuses[i].ok()) {
+        statuses[i] = ProjectColumns(*options.column_projection, &results[i]);
+      }
+    }
+  }
 }
 
 Status DBImpl::CreateColumnFamily(const ColumnFamilyOptions& cf_options,
@@ -14,6 +14,7 @@
 #include <limits>
 #include <list>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -75,6 +76,7 @@ class MemTable;
 class PersistentStatsHistoryIterator;
 class TableCache;
 class TaskLimiterToken;
+class ThreadPoolImpl;
 class Version;
 class VersionEdit;
 class VersionSet;
@@ -1628,11 +1630,17 @@ class DBImpl : public DB {
       pre_sync_size = writer->file()->GetFlushedSize();
     }
 
-    void FinishSync() {
+    void FinishSync(bool synced) {
       assert(getting_synced);
       getting_synced = false;
+      if (synced) {
+        synced_size = pre_sync_size;
+      }
     }
 
+    // Size of the file known to be persisted by a successful sync
+    uint64_t GetSyncedSize() const { return synced_size; }
+
     uint64_t number;
     // Visual Studio doesn't support deque's member to be noncopyable because
     // of a std::unique_ptr as a member.
@@ -1645,6 +1653,7 @@ class DBImpl : public DB {
     // to be persisted even if appends happen during sync so it can be used for
     // tracking the synced size in MANIFEST.
     uint64_t pre_sync_size = 0;
+    uint64_t synced_size = 0;
   };
 
   struct LogContext {
@@ -2194,8 +2203,11 @@ class DBImpl : public DB {
   size_t GetWalPreallocateBlockSize(uint64_t write_buffer_size) const;
   Env::WriteLifeTimeHint CalculateWALWriteHint() { return Env::WLTH_SHORT; }
 
+  // compression_dict primes the compression of the new WAL, see
+  // DBOptions::wal_compression_max_dict_bytes.
   IOStatus CreateWAL(uint64_t log_file_num, uint64_t recycle_log_number,
-                     size_t preallocate_block_size, log::Writer** new_log);
+                     size_t preallocate_block_size, log::Writer** new_log,
+                     const Slice& compression_dict = Slice());
 
   // Validate self-consistency of DB options
   static Status ValidateOptions(const DBOptions& db_options);
@@ -2290,6 +2302,25 @@ class DBImpl : public DB {
       autovector<KeyContext*, MultiGetContext::MAX_BATCH_SIZE>* sorted_keys,
       SuperVersion* sv, SequenceNumber snap_seqnum, ReadCallback* callback);
 
+  // Looks up the batch_size (at most MultiGetContext::MAX_BATCH_SIZE) keys
+  // starting at start_key, first in the memtables and then in the current
+  // version. Returns the total value size so far, starting from
+  // curr_value_size, for enforcing value_size_soft_limit.
+  uint64_t MultiGetBatch(
+      const ReadOptions& read_options, size_t start_key, size_t batch_size,
+      autovector<KeyContext*, MultiGetContext::MAX_BATCH_SIZE>* sorted_keys,
+      SuperVersion* sv, SequenceNumber snap_seqnum, ReadCallback* callback,
+      uint64_t curr_value_size);
+
+  // Calls MultiGetBatch for every batch of the num_keys keys starting at
+  // start_key, spreading the batches over the calling thread and up to
+  // parallelism - 1 threads of multiget_thread_pool_. Returns OK, or
+  // TimedOut if any batch was skipped because of read_options.deadline.
+  Status MultiGetBatchesInParallel(
+      const ReadOptions& read_options, size_t start_key, size_t num_keys,
+      autovector<KeyContext*, MultiGetContext::MAX_BATCH_SIZE>* sorted_keys,
+      SuperVersion* sv, SequenceNumber snap_seqnum, size_t parallelism);
+
   Status DisableFileDeletionsWithLock();
 
   Status IncreaseFullHistoryTsLowImpl(ColumnFamilyData* cfd,
@@ -2297,6 +2328,12 @@ class DBImpl : public DB {
 
   bool ShouldReferenceSuperVersion(const MergeContext& merge_context);
 
+  // Re-materializes `columns` with only the columns named in `projection`
+  // (see ReadOptions::column_projection). Dropped column values are not
+  // copied, and the result no longer pins the original block or buffer.
+  static Status ProjectColumns(const std::vector<Slice>& projection,
+                               PinnableWideColumns* columns);
+
   // Lock over the persistent DB state.  Non-nullptr iff successfully acquired.
   FileLock* db_lock_;
 
@@ -2704,6 +2741,11 @@ class DBImpl : public DB {
   // The number of LockWAL called without matching UnlockWAL call.
   // See also lock_wal_write_token_
   uint32_t lock_wal_count_;
+
+  // Reader threads for ReadOptions::multiget_parallelism, created on first
+  // use (see multiget_thread_pool_once_) and joined in CloseHelper().
+  std::unique_ptr<ThreadPoolImpl> multiget_thread_pool_;
+  std::once_flag multiget_thread_pool_once_;
 };
 
 class GetWithTimestampReadCallback : public ReadCallback {
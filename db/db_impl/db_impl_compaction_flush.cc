@@ -349,6 +349,14 @@ Status DBImpl::FlushMemTableToOutputFile(
       // exists. Otherwise, some tests may fail.  Ignore the error in the
       // interim.
       sfm->OnAddFile(file_path).PermitUncheckedError();
+      for (const FileMetaData& partition_meta :
+           flush_job.GetPartitionOutputs()) {
+        if (partition_meta.fd.GetFileSize() > 0) {
+          sfm->OnAddFile(MakeTableFileName(cfd->ioptions()->cf_paths[0].path,
+                                           partition_meta.fd.GetNumber()))
+              .PermitUncheckedError();
+        }
+      }
       if (sfm->IsMaxAllowedSpaceReached()) {
         Status new_bg_error =
             Status::SpaceLimit("Max allowed space was reached");
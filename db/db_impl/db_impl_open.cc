@@ -1808,7 +1808,8 @@ Status DB::OpenAndTrimHistory(
 
 IOStatus DBImpl::CreateWAL(uint64_t log_file_num, uint64_t recycle_log_number,
                            size_t preallocate_block_size,
-                           log::Writer** new_log) {
+                           log::Writer** new_log,
+                           const Slice& compression_dict) {
   IOStatus io_s;
   std::unique_ptr<FSWritableFile> lfile;
 
@@ -1843,11 +1844,13 @@ IOStatus DBImpl::CreateWAL(uint64_t log_file_num, uint64_t recycle_log_number,
         immutable_db_options_.clock, io_tracer_, nullptr /* stats */, listeners,
         nullptr, tmp_set.Contains(FileType::kWalFile),
         tmp_set.Contains(FileType::kWalFile)));
-    *new_log = new log::Writer(std::move(file_writer), log_file_num,
-                               immutable_db_options_.recycle_log_file_num > 0,
-                               immutable_db_options_.manual_wal_flush,
-                               immutable_db_options_.wal_compression);
-    io_s = (*new_log)->AddCompressionTypeRecord();
+    *new_log = new log::Writer(
+        std::move(file_writer), log_file_num,
+        immutable_db_options_.recycle_log_file_num > 0,
+        immutable_db_options_.manual_wal_flush,
+        immutable_db_options_.wal_compression,
+        immutable_db_options_.wal_compression_max_dict_bytes);
+    io_s = (*new_log)->AddCompressionTypeRecord(compression_dict);
   }
   return io_s;
 }
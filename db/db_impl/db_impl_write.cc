@@ -7,6 +7,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file. See the AUTHORS file for names of contributors.
 #include <cinttypes>
+#include <memory>
 
 #include "db/db_impl/db_impl.h"
 #include "db/error_handler.h"
@@ -16,8 +17,25 @@
 #include "options/options_helper.h"
 #include "test_util/sync_point.h"
 #include "util/cast_util.h"
+#include "util/random.h"
 
 namespace ROCKSDB_NAMESPACE {
+namespace {
+// One in this many writes records the latency of each stage of the write
+// path, which keeps the extra clock reads off most writes.
+constexpr int kWriteStageSampleRate = 16;
+
+// Returns the statistics that the stage latencies of a write are recorded
+// in, or nullptr if the write is not sampled.
+Statistics* SampleWriteStageStats(Statistics* stats) {
+  if (stats == nullptr ||
+      !Random::GetTLSInstance()->OneIn(kWriteStageSampleRate)) {
+    return nullptr;
+  }
+  return stats;
+}
+}  // anonymous namespace
+
 // Convenience methods
 Status DBImpl::Put(const WriteOptions& o, ColumnFamilyHandle* column_family,
                    const Slice& key, const Slice& val) {
@@ -307,14 +325,21 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
                         disable_memtable, batch_cnt, pre_release_callback,
                         post_memtable_callback);
   StopWatch write_sw(immutable_db_options_.clock, stats_, DB_WRITE);
+  Statistics* const stage_stats = SampleWriteStageStats(stats_);
 
-  write_thread_.JoinBatchGroup(&w);
+  {
+    StopWatch join_sw(immutable_db_options_.clock, stage_stats,
+                      WRITE_JOIN_GROUP_MICROS);
+    write_thread_.JoinBatchGroup(&w);
+  }
   if (w.state == WriteThread::STATE_PARALLEL_MEMTABLE_WRITER) {
     // we are a non-leader in a parallel group
 
     if (w.ShouldWriteToMemtable()) {
       PERF_TIMER_STOP(write_pre_and_post_process_time);
       PERF_TIMER_GUARD(write_memtable_time);
+      StopWatch memtable_sw(immutable_db_options_.clock, stage_stats,
+                            WRITE_MEMTABLE_MICROS);
 
       ColumnFamilyMemTablesImpl column_family_memtables(
           versions_->GetColumnFamilySet());
@@ -335,6 +360,8 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
       for (auto* tmp_w : *(w.write_group)) {
         assert(tmp_w);
         if (tmp_w->post_memtable_callback) {
+          StopWatch callback_sw(immutable_db_options_.clock, stage_stats,
+                                WRITE_CALLBACK_MICROS);
           Status tmp_s =
               (*tmp_w->post_memtable_callback)(last_sequence, disable_memtable);
           // TODO: propagate the execution status of post_memtable_callback to
@@ -397,8 +424,12 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
   // into memtables
 
   TEST_SYNC_POINT("DBImpl::WriteImpl:BeforeLeaderEnters");
-  last_batch_group_size_ =
-      write_thread_.EnterAsBatchGroupLeader(&w, &write_group);
+  {
+    StopWatch form_group_sw(immutable_db_options_.clock, stage_stats,
+                            WRITE_FORM_GROUP_MICROS);
+    last_batch_group_size_ =
+        write_thread_.EnterAsBatchGroupLeader(&w, &write_group);
+  }
 
   IOStatus io_s;
   Status pre_release_cb_status;
@@ -476,6 +507,7 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
       RecordTick(stats_, WRITE_DONE_BY_OTHER, write_done_by_other);
     }
     RecordInHistogram(stats_, BYTES_PER_WRITE, total_byte_size);
+    RecordInHistogram(stats_, WRITE_GROUP_SIZE, write_group.size);
 
     if (write_options.disableWAL) {
       has_unpersisted_data_.store(true, std::memory_order_relaxed);
@@ -489,6 +521,8 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
         LogFileNumberSize& log_file_number_size =
             *(log_context.log_file_number_size);
         PERF_TIMER_GUARD(write_wal_time);
+        StopWatch wal_sw(immutable_db_options_.clock, stage_stats,
+                         WRITE_WAL_MICROS);
         io_s =
             WriteToWAL(write_group, log_context.writer, log_used,
                        log_context.need_log_sync, log_context.need_log_dir_sync,
@@ -497,6 +531,8 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
     } else {
       if (status.ok() && !write_options.disableWAL) {
         PERF_TIMER_GUARD(write_wal_time);
+        StopWatch wal_sw(immutable_db_options_.clock, stage_stats,
+                         WRITE_WAL_MICROS);
         // LastAllocatedSequence is increased inside WriteToWAL under
         // wal_write_mutex_ to ensure ordered events in WAL
         io_s = ConcurrentWriteToWAL(write_group, log_used, &last_sequence,
@@ -525,6 +561,8 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
         }
         writer->sequence = next_sequence;
         if (writer->pre_release_callback) {
+          StopWatch callback_sw(immutable_db_options_.clock, stage_stats,
+                                WRITE_CALLBACK_MICROS);
           Status ws = writer->pre_release_callback->Callback(
               writer->sequence, disable_memtable, writer->log_used, index++,
               pre_release_callback_cnt);
@@ -544,6 +582,8 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
 
     if (status.ok()) {
       PERF_TIMER_GUARD(write_memtable_time);
+      StopWatch memtable_sw(immutable_db_options_.clock, stage_stats,
+                            WRITE_MEMTABLE_MICROS);
 
       if (!parallel) {
         // w.sequence will be set inside InsertInto
@@ -631,6 +671,8 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
       for (auto* tmp_w : write_group) {
         assert(tmp_w);
         if (tmp_w->post_memtable_callback) {
+          StopWatch callback_sw(immutable_db_options_.clock, stage_stats,
+                                WRITE_CALLBACK_MICROS);
           Status tmp_s =
               (*tmp_w->post_memtable_callback)(last_sequence, disable_memtable);
           // TODO: propagate the execution status of post_memtable_callback to
@@ -664,7 +706,12 @@ Status DBImpl::PipelinedWriteImpl(const WriteOptions& write_options,
   WriteThread::Writer w(write_options, my_batch, callback, log_ref,
                         disable_memtable, /*_batch_cnt=*/0,
                         /*_pre_release_callback=*/nullptr);
-  write_thread_.JoinBatchGroup(&w);
+  Statistics* const stage_stats = SampleWriteStageStats(stats_);
+  {
+    StopWatch join_sw(immutable_db_options_.clock, stage_stats,
+                      WRITE_JOIN_GROUP_MICROS);
+    write_thread_.JoinBatchGroup(&w);
+  }
   TEST_SYNC_POINT("DBImplWrite::PipelinedWriteImpl:AfterJoinBatchGroup");
   if (w.state == WriteThread::STATE_GROUP_LEADER) {
     WriteThread::WriteGroup wal_write_group;
@@ -678,8 +725,12 @@ Status DBImpl::PipelinedWriteImpl(const WriteOptions& write_options,
     PERF_TIMER_START(write_pre_and_post_process_time);
 
     // This can set non-OK status if callback fail.
-    last_batch_group_size_ =
-        write_thread_.EnterAsBatchGroupLeader(&w, &wal_write_group);
+    {
+      StopWatch form_group_sw(immutable_db_options_.clock, stage_stats,
+                              WRITE_FORM_GROUP_MICROS);
+      last_batch_group_size_ =
+          write_thread_.EnterAsBatchGroupLeader(&w, &wal_write_group);
+    }
     const SequenceNumber current_sequence =
         write_thread_.UpdateLastSequence(versions_->LastSequence()) + 1;
     size_t total_count = 0;
@@ -723,6 +774,7 @@ Status DBImpl::PipelinedWriteImpl(const WriteOptions& write_options,
     stats->AddDBStats(InternalStats::kIntStatsBytesWritten, total_byte_size);
     RecordTick(stats_, BYTES_WRITTEN, total_byte_size);
     RecordInHistogram(stats_, BYTES_PER_WRITE, total_byte_size);
+    RecordInHistogram(stats_, WRITE_GROUP_SIZE, wal_write_group.size);
 
     PERF_TIMER_STOP(write_pre_and_post_process_time);
 
@@ -731,6 +783,8 @@ Status DBImpl::PipelinedWriteImpl(const WriteOptions& write_options,
 
     if (w.status.ok() && !write_options.disableWAL) {
       PERF_TIMER_GUARD(write_wal_time);
+      StopWatch wal_sw(immutable_db_options_.clock, stage_stats,
+                       WRITE_WAL_MICROS);
       stats->AddDBStats(InternalStats::kIntStatsWriteDoneBySelf, 1);
       RecordTick(stats_, WRITE_DONE_BY_SELF, 1);
       if (wal_write_group.size > 1) {
@@ -786,6 +840,8 @@ Status DBImpl::PipelinedWriteImpl(const WriteOptions& write_options,
         immutable_db_options_.allow_concurrent_memtable_write) {
       write_thread_.LaunchParallelMemTableWriters(&memtable_write_group);
     } else {
+      StopWatch memtable_sw(immutable_db_options_.clock, stage_stats,
+                            WRITE_MEMTABLE_MICROS);
       memtable_write_group.status = WriteBatchInternal::InsertInto(
           memtable_write_group, w.sequence, column_family_memtables_.get(),
           &flush_scheduler_, &trim_history_scheduler_,
@@ -804,12 +860,17 @@ Status DBImpl::PipelinedWriteImpl(const WriteOptions& write_options,
     assert(w.ShouldWriteToMemtable());
     ColumnFamilyMemTablesImpl column_family_memtables(
         versions_->GetColumnFamilySet());
-    w.status = WriteBatchInternal::InsertInto(
-        &w, w.sequence, &column_family_memtables, &flush_scheduler_,
-        &trim_history_scheduler_, write_options.ignore_missing_column_families,
-        0 /*log_number*/, this, true /*concurrent_memtable_writes*/,
-        false /*seq_per_batch*/, 0 /*batch_cnt*/, true /*batch_per_txn*/,
-        write_options.memtable_insert_hint_per_batch);
+    {
+      StopWatch memtable_sw(immutable_db_options_.clock, stage_stats,
+                            WRITE_MEMTABLE_MICROS);
+      w.status = WriteBatchInternal::InsertInto(
+          &w, w.sequence, &column_family_memtables, &flush_scheduler_,
+          &trim_history_scheduler_,
+          write_options.ignore_missing_column_families, 0 /*log_number*/, this,
+          true /*concurrent_memtable_writes*/, false /*seq_per_batch*/,
+          0 /*batch_cnt*/, true /*batch_per_txn*/,
+          write_options.memtable_insert_hint_per_batch);
+    }
     if (write_thread_.CompleteParallelMemTableWriter(&w)) {
       MemTableInsertStatusCheck(w.status);
       versions_->SetLastSequence(w.write_group->last_sequence);
@@ -885,8 +946,13 @@ Status DBImpl::WriteImplWALOnly(
   WriteThread::Writer w(write_options, my_batch, callback, log_ref,
                         disable_memtable, sub_batch_cnt, pre_release_callback);
   StopWatch write_sw(immutable_db_options_.clock, stats_, DB_WRITE);
+  Statistics* const stage_stats = SampleWriteStageStats(stats_);
 
-  write_thread->JoinBatchGroup(&w);
+  {
+    StopWatch join_sw(immutable_db_options_.clock, stage_stats,
+                      WRITE_JOIN_GROUP_MICROS);
+    write_thread->JoinBatchGroup(&w);
+  }
   assert(w.state != WriteThread::STATE_PARALLEL_MEMTABLE_WRITER);
   if (w.state == WriteThread::STATE_COMPLETED) {
     if (log_used != nullptr) {
@@ -936,7 +1002,11 @@ Status DBImpl::WriteImplWALOnly(
 
   WriteThread::WriteGroup write_group;
   uint64_t last_sequence;
-  write_thread->EnterAsBatchGroupLeader(&w, &write_group);
+  {
+    StopWatch form_group_sw(immutable_db_options_.clock, stage_stats,
+                            WRITE_FORM_GROUP_MICROS);
+    write_thread->EnterAsBatchGroupLeader(&w, &write_group);
+  }
   // Note: no need to update last_batch_group_size_ here since the batch writes
   // to WAL only
   // TODO: this use of operator bool on `tracer_` can avoid unnecessary lock
@@ -983,6 +1053,7 @@ Status DBImpl::WriteImplWALOnly(
     RecordTick(stats_, WRITE_DONE_BY_OTHER, write_done_by_other);
   }
   RecordInHistogram(stats_, BYTES_PER_WRITE, total_byte_size);
+  RecordInHistogram(stats_, WRITE_GROUP_SIZE, write_group.size);
 
   PERF_TIMER_STOP(write_pre_and_post_process_time);
 
@@ -1002,8 +1073,13 @@ Status DBImpl::WriteImplWALOnly(
   }
   Status status;
   if (!write_options.disableWAL) {
-    IOStatus io_s =
-        ConcurrentWriteToWAL(write_group, log_used, &last_sequence, seq_inc);
+    IOStatus io_s;
+    {
+      StopWatch wal_sw(immutable_db_options_.clock, stage_stats,
+                       WRITE_WAL_MICROS);
+      io_s =
+          ConcurrentWriteToWAL(write_group, log_used, &last_sequence, seq_inc);
+    }
     status = io_s;
     // last_sequence may not be set if there is an error
     // This error checking and return is moved up to avoid using uninitialized
@@ -1054,6 +1130,8 @@ Status DBImpl::WriteImplWALOnly(
     for (auto* writer : write_group) {
       if (!writer->CallbackFailed() && writer->pre_release_callback) {
         assert(writer->sequence != kMaxSequenceNumber);
+        StopWatch callback_sw(immutable_db_options_.clock, stage_stats,
+                              WRITE_CALLBACK_MICROS);
         Status ws = writer->pre_release_callback->Callback(
             writer->sequence, disable_memtable, writer->log_used, index++,
             pre_release_callback_cnt);
@@ -2128,12 +2206,23 @@ Status DBImpl::SwitchMemtable(ColumnFamilyData* cfd, WriteContext* context) {
   int num_imm_unflushed = cfd->imm()->NumNotFlushed();
   const auto preallocate_block_size =
       GetWalPreallocateBlockSize(mutable_cf_options.write_buffer_size);
+  // Prime the new WAL's compression with the latest records of the current
+  // one. No WAL writes are in progress as this thread is at the front of the
+  // writer queue(s).
+  std::string wal_compression_dict;
+  if (creating_new_log &&
+      immutable_db_options_.wal_compression_max_dict_bytes > 0) {
+    InstrumentedMutexLock l(&log_write_mutex_);
+    if (!logs_.empty()) {
+      wal_compression_dict = logs_.back().writer->RecentRecordData().ToString();
+    }
+  }
   mutex_.Unlock();
   if (creating_new_log) {
     // TODO: Write buffer size passed in should be max of all CF's instead
     // of mutable_cf_options.write_buffer_size.
     io_s = CreateWAL(new_log_number, recycle_log_number, preallocate_block_size,
-                     &new_log);
+                     &new_log, wal_compression_dict);
     if (s.ok()) {
       s = io_s;
     }
@@ -2313,6 +2402,50 @@ size_t DBImpl::GetWalPreallocateBlockSize(uint64_t write_buffer_size) const {
   return bsize;
 }
 
+namespace {
+// Batches that grew larger than this are freed after use instead of being
+// kept in the calling thread's pool.
+constexpr size_t kMaxPooledWriteBatchBytes = 64 << 10;
+
+thread_local std::unique_ptr<WriteBatch> pooled_write_batch;
+
+// The single-operation convenience methods below reuse a per-thread
+// WriteBatch, so that a stream of Put()s does not allocate a new batch buffer
+// and protection info on every call. The batch is borrowed for the lifetime
+// of this object; a nested write on the same thread finds the pool empty and
+// gets a batch of its own.
+class PooledWriteBatch {
+ public:
+  PooledWriteBatch(size_t reserved_bytes, size_t protection_bytes_per_key)
+      : batch_(std::move(pooled_write_batch)) {
+    if (batch_ == nullptr ||
+        batch_->GetProtectionBytesPerKey() != protection_bytes_per_key) {
+      batch_.reset(new WriteBatch(reserved_bytes, 0 /* max_bytes */,
+                                  protection_bytes_per_key,
+                                  0 /* default_cf_ts_sz */));
+    } else {
+      batch_->Reserve(reserved_bytes);
+    }
+  }
+
+  ~PooledWriteBatch() {
+    if (pooled_write_batch == nullptr &&
+        batch_->Data().capacity() <= kMaxPooledWriteBatchBytes) {
+      batch_->Clear();
+      pooled_write_batch = std::move(batch_);
+    }
+  }
+
+  PooledWriteBatch(const PooledWriteBatch&) = delete;
+  PooledWriteBatch& operator=(const PooledWriteBatch&) = delete;
+
+  WriteBatch* get() { return batch_.get(); }
+
+ private:
+  std::unique_ptr<WriteBatch> batch_;
+};
+}  // anonymous namespace
+
 // Default implementations of convenience methods that subclasses of DB
 // can call if they wish
 Status DB::Put(const WriteOptions& opt, ColumnFamilyHandle* column_family,
@@ -2320,13 +2453,13 @@ Status DB::Put(const WriteOptions& opt, ColumnFamilyHandle* column_family,
   // Pre-allocate size of write batch conservatively.
   // 8 bytes are taken by header, 4 bytes for count, 1 byte for type,
   // and we allocate 11 extra bytes for key length, as well as value length.
-  WriteBatch batch(key.size() + value.size() + 24, 0 /* max_bytes */,
-                   opt.protection_bytes_per_key, 0 /* default_cf_ts_sz */);
-  Status s = batch.Put(column_family, key, value);
+  PooledWriteBatch batch(key.size() + value.size() + 24,
+                         opt.protection_bytes_per_key);
+  Status s = batch.get()->Put(column_family, key, value);
   if (!s.ok()) {
     return s;
   }
-  return Write(opt, &batch);
+  return Write(opt, batch.get());
 }
 
 Status DB::Put(const WriteOptions& opt, ColumnFamilyHandle* column_family,
@@ -2368,13 +2501,12 @@ Status DB::PutEntity(const WriteOptions& options,
 
 Status DB::Delete(const WriteOptions& opt, ColumnFamilyHandle* column_family,
                   const Slice& key) {
-  WriteBatch batch(0 /* reserved_bytes */, 0 /* max_bytes */,
-                   opt.protection_bytes_per_key, 0 /* default_cf_ts_sz */);
-  Status s = batch.Delete(column_family, key);
+  PooledWriteBatch batch(0 /* reserved_bytes */, opt.protection_bytes_per_key);
+  Status s = batch.get()->Delete(column_family, key);
   if (!s.ok()) {
     return s;
   }
-  return Write(opt, &batch);
+  return Write(opt, batch.get());
 }
 
 Status DB::Delete(const WriteOptions& opt, ColumnFamilyHandle* column_family,
@@ -2395,13 +2527,12 @@ Status DB::Delete(const WriteOptions& opt, ColumnFamilyHandle* column_family,
 
 Status DB::SingleDelete(const WriteOptions& opt,
                         ColumnFamilyHandle* column_family, const Slice& key) {
-  WriteBatch batch(0 /* reserved_bytes */, 0 /* max_bytes */,
-                   opt.protection_bytes_per_key, 0 /* default_cf_ts_sz */);
-  Status s = batch.SingleDelete(column_family, key);
+  PooledWriteBatch batch(0 /* reserved_bytes */, opt.protection_bytes_per_key);
+  Status s = batch.get()->SingleDelete(column_family, key);
   if (!s.ok()) {
     return s;
   }
-  return Write(opt, &batch);
+  return Write(opt, batch.get());
 }
 
 Status DB::SingleDelete(const WriteOptions& opt,
@@ -2424,13 +2555,12 @@ Status DB::SingleDelete(const WriteOptions& opt,
 Status DB::DeleteRange(const WriteOptions& opt,
                        ColumnFamilyHandle* column_family,
                        const Slice& begin_key, const Slice& end_key) {
-  WriteBatch batch(0 /* reserved_bytes */, 0 /* max_bytes */,
-                   opt.protection_bytes_per_key, 0 /* default_cf_ts_sz */);
-  Status s = batch.DeleteRange(column_family, begin_key, end_key);
+  PooledWriteBatch batch(0 /* reserved_bytes */, opt.protection_bytes_per_key);
+  Status s = batch.get()->DeleteRange(column_family, begin_key, end_key);
   if (!s.ok()) {
     return s;
   }
-  return Write(opt, &batch);
+  return Write(opt, batch.get());
 }
 
 Status DB::DeleteRange(const WriteOptions& opt,
@@ -2453,13 +2583,12 @@ Status DB::DeleteRange(const WriteOptions& opt,
 
 Status DB::Merge(const WriteOptions& opt, ColumnFamilyHandle* column_family,
                  const Slice& key, const Slice& value) {
-  WriteBatch batch(0 /* reserved_bytes */, 0 /* max_bytes */,
-                   opt.protection_bytes_per_key, 0 /* default_cf_ts_sz */);
-  Status s = batch.Merge(column_family, key, value);
+  PooledWriteBatch batch(0 /* reserved_bytes */, opt.protection_bytes_per_key);
+  Status s = batch.get()->Merge(column_family, key, value);
   if (!s.ok()) {
     return s;
   }
-  return Write(opt, &batch);
+  return Write(opt, batch.get());
 }
 
 Status DB::Merge(const WriteOptions& opt, ColumnFamilyHandle* column_family,
@@ -81,7 +81,8 @@ DBIter::DBIter(Env* _env, const ReadOptions& read_options,
       cfd_(cfd),
       timestamp_ub_(read_options.timestamp),
       timestamp_lb_(read_options.iter_start_ts),
-      timestamp_size_(timestamp_ub_ ? timestamp_ub_->size() : 0) {
+      timestamp_size_(timestamp_ub_ ? timestamp_ub_->size() : 0),
+      column_projection_(read_options.column_projection) {
   RecordTick(statistics_, NO_ITERATOR_CREATED);
   if (pin_thru_lifetime_) {
     pinned_iters_mgr_.StartPinning();
@@ -178,6 +179,30 @@ void DBIter::Next() {
   }
 }
 
+Status DBIter::NextBatch(size_t max_entries, KeyValueBatch* batch) {
+  assert(batch);
+  batch->Clear();
+
+  for (size_t i = 0; i < max_entries && valid_; ++i) {
+    // With pin_data, keys and values read directly from the internal iterator
+    // stay valid for the lifetime of the iterator, so only merge results,
+    // blob values, and entries resolved while moving backward (which live in
+    // saved_value_/pinned_value_) need to be copied.
+    const bool key_pinned =
+        pin_thru_lifetime_ && !timestamp_lb_ && saved_key_.IsKeyPinned();
+    const bool value_pinned =
+        pin_thru_lifetime_ && direction_ == kForward &&
+        !current_entry_is_merged_ && !is_blob_ && iter_.Valid() &&
+        iter_.iter()->IsValuePinned();
+    batch->Append(key(), key_pinned, value_, value_pinned);
+
+    // Not a virtual call since DBIter is final
+    Next();
+  }
+
+  return status();
+}
+
 bool DBIter::SetBlobValueIfNeeded(const Slice& user_key,
                                   const Slice& blob_index) {
   assert(!is_blob_);
@@ -234,6 +259,10 @@ bool DBIter::SetValueAndColumnsFromEntity(Slice slice) {
     value_ = wide_columns_[0].value();
   }
 
+  if (column_projection_) {
+    WideColumnSerialization::Project(*column_projection_, wide_columns_);
+  }
+
   return true;
 }
 
@@ -13,6 +13,7 @@
 
 #include "db/db_impl/db_impl.h"
 #include "db/range_del_aggregator.h"
+#include "db/wide/wide_column_serialization.h"
 #include "memory/arena.h"
 #include "options/cf_options.h"
 #include "rocksdb/db.h"
@@ -170,6 +171,8 @@ class DBIter final : public Iterator {
     return wide_columns_;
   }
 
+  Status NextBatch(size_t max_entries, KeyValueBatch* batch) override;
+
   Status status() const override {
     if (status_.ok()) {
       return iter_.status();
@@ -308,6 +311,10 @@ class DBIter final : public Iterator {
 
     value_ = slice;
     wide_columns_.emplace_back(kDefaultWideColumnName, slice);
+
+    if (column_projection_) {
+      WideColumnSerialization::Project(*column_projection_, wide_columns_);
+    }
   }
 
   bool SetValueAndColumnsFromEntity(Slice slice);
@@ -393,6 +400,8 @@ class DBIter final : public Iterator {
   const Slice* const timestamp_ub_;
   const Slice* const timestamp_lb_;
   const size_t timestamp_size_;
+  // Names of the columns exposed via columns(); all columns if nullptr.
+  const std::vector<Slice>* const column_projection_;
   std::string saved_timestamp_;
 };
 
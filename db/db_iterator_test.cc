@@ -749,6 +749,73 @@ TEST_P(DBIteratorTest, IterSmallAndLargeMix) {
   } while (ChangeCompactOptions());
 }
 
+TEST_P(DBIteratorTest, NextBatch) {
+  Options options = CurrentOptions();
+  DestroyAndReopen(options);
+
+  Random rnd(301);
+  std::vector<std::pair<std::string, std::string>> expected;
+  for (int i = 0; i < 200; ++i) {
+    std::string key = Key(i);
+    // Mix in values larger than the batch's buffer size
+    std::string value = rnd.RandomString(i % 10 == 0 ? 5000 : 20);
+    ASSERT_OK(Put(key, value));
+    if (i % 7 == 0) {
+      ASSERT_OK(Delete(key));
+    } else {
+      expected.emplace_back(key, value);
+    }
+    if (i == 100) {
+      ASSERT_OK(Flush());
+    }
+  }
+
+  for (bool pin_data : {false, true}) {
+    ReadOptions read_options;
+    read_options.pin_data = pin_data;
+    std::unique_ptr<Iterator> iter(NewIterator(read_options));
+
+    KeyValueBatch batch;
+    size_t pos = 0;
+    iter->SeekToFirst();
+    while (iter->Valid()) {
+      ASSERT_OK(iter->NextBatch(13, &batch));
+      ASSERT_GT(batch.size(), 0);
+      ASSERT_LE(batch.size(), 13);
+      for (size_t i = 0; i < batch.size(); ++i, ++pos) {
+        ASSERT_LT(pos, expected.size());
+        ASSERT_EQ(batch.keys()[i], expected[pos].first);
+        ASSERT_EQ(batch.values()[i], expected[pos].second);
+      }
+    }
+    ASSERT_OK(iter->status());
+    ASSERT_EQ(pos, expected.size());
+
+    // Iterator not valid: nothing is returned
+    ASSERT_OK(iter->NextBatch(13, &batch));
+    ASSERT_TRUE(batch.empty());
+
+    // Batch started after moving backward
+    iter->SeekToLast();
+    iter->Prev();
+    ASSERT_OK(iter->NextBatch(5, &batch));
+    ASSERT_EQ(batch.size(), 2);
+    ASSERT_EQ(batch.keys()[0], expected[expected.size() - 2].first);
+    ASSERT_EQ(batch.values()[0], expected[expected.size() - 2].second);
+    ASSERT_EQ(batch.keys()[1], expected.back().first);
+    ASSERT_EQ(batch.values()[1], expected.back().second);
+    ASSERT_FALSE(iter->Valid());
+    ASSERT_OK(iter->status());
+
+    // The iterator is left on the entry after the batch
+    iter->Seek(expected[10].first);
+    ASSERT_OK(iter->NextBatch(3, &batch));
+    ASSERT_EQ(batch.size(), 3);
+    ASSERT_TRUE(iter->Valid());
+    ASSERT_EQ(iter->key(), expected[13].first);
+  }
+}
+
 TEST_P(DBIteratorTest, IterMultiWithDelete) {
   do {
     CreateAndReopenWithCF({"pikachu"}, CurrentOptions());
@@ -335,6 +335,59 @@ TEST_F(DBMemTableTest, ColumnFamilyId) {
   }
 }
 
+TEST_F(DBMemTableTest, HashIndex) {
+  Options options = CurrentOptions();
+  options.memtable_hash_index_size_ratio = 0.01;
+  options.merge_operator = MergeOperators::CreateStringAppendOperator();
+  DestroyAndReopen(options);
+
+  std::atomic<int> index_hits{0};
+  SyncPoint::GetInstance()->SetCallBack(
+      "MemTable::GetFromTable:HashIndexHit",
+      [&](void* /*arg*/) { index_hits.fetch_add(1); });
+  SyncPoint::GetInstance()->EnableProcessing();
+
+  ASSERT_OK(Put("a", "v1"));
+  const Snapshot* snapshot = db_->GetSnapshot();
+  ASSERT_OK(Put("a", "v2"));
+  ASSERT_OK(Put("b", "v1"));
+  ASSERT_OK(Delete("b"));
+  ASSERT_OK(Put("c", "v1"));
+  ASSERT_OK(Merge("c", "v2"));
+
+  // The newest versions of "a" and "b" answer the lookups by themselves
+  ASSERT_EQ("v2", Get("a"));
+  ASSERT_EQ("NOT_FOUND", Get("b"));
+  ASSERT_EQ(2, index_hits.load());
+
+  // A merge operand, an older version, and a missing key need the rep or
+  // nothing at all
+  ASSERT_EQ("v1,v2", Get("c"));
+  ASSERT_EQ("v1", Get("a", snapshot));
+  ASSERT_EQ("NOT_FOUND", Get("d"));
+  ASSERT_EQ(2, index_hits.load());
+
+  ASSERT_EQ(std::vector<std::string>({"v2", "NOT_FOUND", "v1,v2", "NOT_FOUND"}),
+            MultiGet({"a", "b", "c", "d"}));
+  ASSERT_EQ(4, index_hits.load());
+
+  // Range deletions still cover the entries found through the index
+  ASSERT_OK(db_->DeleteRange(WriteOptions(), db_->DefaultColumnFamily(), "a",
+                             "b"));
+  ASSERT_EQ("NOT_FOUND", Get("a"));
+  ASSERT_EQ("v1", Get("a", snapshot));
+
+  db_->ReleaseSnapshot(snapshot);
+  SyncPoint::GetInstance()->DisableProcessing();
+  SyncPoint::GetInstance()->ClearAllCallBacks();
+
+  // Results are the same once the data is flushed
+  ASSERT_OK(Flush());
+  ASSERT_EQ("NOT_FOUND", Get("a"));
+  ASSERT_EQ("NOT_FOUND", Get("b"));
+  ASSERT_EQ("v1,v2", Get("c"));
+}
+
 }  // namespace ROCKSDB_NAMESPACE
 
 int main(int argc, char** argv) {
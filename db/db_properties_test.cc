@@ -2281,6 +2281,42 @@ TEST_F(DBPropertiesTest, GetMapPropertyWriteStallStats) {
   }
 }
 
+TEST_F(DBPropertiesTest, GetMapPropertyWriteStageStats) {
+  Options options = CurrentOptions();
+  options.statistics = nullptr;
+  Reopen(options);
+
+  // The stage latencies come from statistics
+  std::map<std::string, std::string> values;
+  ASSERT_FALSE(
+      db_->GetMapProperty(DB::Properties::kDBWriteStageStats, &values));
+
+  options.statistics = CreateDBStatistics();
+  Reopen(options);
+  WriteOptions sync_write;
+  sync_write.sync = true;
+  // Only a sample of the writes time their stages
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_OK(db_->Put(i % 10 == 0 ? sync_write : WriteOptions(), Key(i),
+                       "value"));
+  }
+
+  ASSERT_TRUE(
+      db_->GetMapProperty(DB::Properties::kDBWriteStageStats, &values));
+  for (const char* stage : {"join_group", "form_group", "wal", "memtable"}) {
+    ASSERT_GT(std::stoull(values[std::string(stage) + ".count"]), 0U);
+    ASSERT_LE(std::stoull(values[std::string(stage) + ".count"]), 1000U);
+  }
+  ASSERT_GE(std::stoull(values["wal_sync.count"]), 100U);
+  ASSERT_EQ(0U, std::stoull(values["callback.count"]));
+  ASSERT_EQ(0U, std::stoull(values["delay.count"]));
+  ASSERT_EQ(1U, values.count("memtable.p99"));
+
+  std::string value;
+  ASSERT_TRUE(db_->GetProperty(DB::Properties::kDBWriteStageStats, &value));
+  ASSERT_NE(std::string::npos, value.find("memtable"));
+}
+
 namespace {
 std::string PopMetaIndexKey(InternalIterator* meta_iter) {
   Status s = meta_iter->status();
@@ -279,6 +279,44 @@ TEST_F(DBWALTest, SyncWALNotWaitWrite) {
   ROCKSDB_NAMESPACE::SyncPoint::GetInstance()->DisableProcessing();
 }
 
+TEST_F(DBWALTest, SyncWALGroupCommit) {
+  Options options = CurrentOptions();
+  options.statistics = CreateDBStatistics();
+  DestroyAndReopen(options);
+  ASSERT_OK(Put("foo1", "bar1"));
+
+  // The second SyncWAL() starts while the first one is syncing everything it
+  // needs, so it waits for that sync and then returns without its own.
+  SyncPoint::GetInstance()->LoadDependency({
+      {"DBWALTest::SyncWALNotWaitWrite:1", "DBWALTest::SyncWALGroupCommit:1"},
+      {"DBImpl::SyncWAL:WaitForPendingSync",
+       "DBImpl::SyncWAL:BeforeMarkLogsSynced:1"},
+  });
+  int already_synced = 0;
+  SyncPoint::GetInstance()->SetCallBack("DBImpl::SyncWAL:AlreadySynced",
+                                        [&](void*) { ++already_synced; });
+  SyncPoint::GetInstance()->EnableProcessing();
+
+  port::Thread thread([&]() { ASSERT_OK(db_->SyncWAL()); });
+  TEST_SYNC_POINT("DBWALTest::SyncWALGroupCommit:1");
+  ASSERT_OK(db_->SyncWAL());
+  thread.join();
+  ASSERT_EQ(1, already_synced);
+  ASSERT_EQ(1, options.statistics->getTickerCount(WAL_FILE_SYNCED));
+
+  SyncPoint::GetInstance()->DisableProcessing();
+  SyncPoint::GetInstance()->ClearAllCallBacks();
+  SyncPoint::GetInstance()->LoadDependency({});
+
+  // Nothing written since the last sync
+  ASSERT_OK(db_->SyncWAL());
+  ASSERT_EQ(1, options.statistics->getTickerCount(WAL_FILE_SYNCED));
+
+  ASSERT_OK(Put("foo2", "bar2"));
+  ASSERT_OK(db_->SyncWAL());
+  ASSERT_EQ(2, options.statistics->getTickerCount(WAL_FILE_SYNCED));
+}
+
 TEST_F(DBWALTest, Recover) {
   do {
     CreateAndReopenWithCF({"pikachu"}, CurrentOptions());
@@ -2399,6 +2437,34 @@ TEST_F(DBWALTest, GetCompressedWalsAfterSync) {
   Status s = dbfull()->GetSortedWalFiles(wals);
   ASSERT_OK(s);
 }
+
+TEST_F(DBWALTest, WalCompressionDictionary) {
+  if (!StreamingCompressionTypeSupported(kZSTD)) {
+    ROCKSDB_GTEST_BYPASS("stream compression not present");
+    return;
+  }
+  Options options = CurrentOptions();
+  options.wal_compression = kZSTD;
+  options.wal_compression_max_dict_bytes = 4096;
+  DestroyAndReopen(options);
+
+  Random rnd(301);
+  std::string value = rnd.RandomString(100);
+  for (int i = 0; i < 100; i++) {
+    ASSERT_OK(Put(Key(i), value + std::to_string(i)));
+  }
+  // The new WAL is primed with the latest records of the current one
+  ASSERT_OK(Flush());
+  for (int i = 100; i < 200; i++) {
+    ASSERT_OK(Put(Key(i), value + std::to_string(i)));
+  }
+
+  Reopen(options);
+  for (int i = 0; i < 200; i++) {
+    ASSERT_EQ(value + std::to_string(i), Get(Key(i)));
+  }
+  ASSERT_OK(db_->VerifyChecksum());
+}
 }  // namespace ROCKSDB_NAMESPACE
 
 int main(int argc, char** argv) {
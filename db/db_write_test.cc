@@ -775,6 +775,84 @@ TEST_P(DBWriteTest, ConcurrentlyDisabledWAL) {
   ASSERT_LE(bytes_num, 1024 * 100);
 }
 
+TEST_P(DBWriteTest, SingleOperationWritesReuseBatch) {
+  // Single-operation writes share a per-thread batch. Switching the protection
+  // setting or writing a value too large to be kept pooled must not leak
+  // anything into the following writes.
+  Options options = GetOptions();
+  Reopen(options);
+  WriteOptions protected_opts;
+  protected_opts.protection_bytes_per_key = 8;
+  const std::string large_value(1 << 20, 'L');
+  for (int i = 0; i < 20; i++) {
+    const WriteOptions& wo = (i % 3 == 0) ? protected_opts : WriteOptions();
+    const std::string key = "key" + std::to_string(i);
+    ASSERT_OK(db_->Put(wo, key, i % 5 == 0 ? large_value : "v" + key));
+    ASSERT_OK(db_->Delete(wo, "deleted" + key));
+    ASSERT_OK(db_->SingleDelete(wo, "single_deleted" + key));
+  }
+  ASSERT_OK(db_->DeleteRange(WriteOptions(), db_->DefaultColumnFamily(),
+                             "key18", "key19"));
+
+  for (int i = 0; i < 20; i++) {
+    const std::string key = "key" + std::to_string(i);
+    if (i == 18) {
+      ASSERT_EQ("NOT_FOUND", Get(key));
+    } else {
+      ASSERT_EQ(i % 5 == 0 ? large_value : "v" + key, Get(key));
+    }
+  }
+  // Only the puts remain visible
+  std::unique_ptr<Iterator> iter(db_->NewIterator(ReadOptions()));
+  int count = 0;
+  for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+    ASSERT_TRUE(iter->key().starts_with("key"));
+    count++;
+  }
+  ASSERT_OK(iter->status());
+  ASSERT_EQ(19, count);
+}
+
+TEST_P(DBWriteTest, AdaptiveWriteGroupSize) {
+  Options options = GetOptions();
+  options.adaptive_write_group_size = true;
+  options.write_group_max_wait_usec = 200;
+  options.statistics = ROCKSDB_NAMESPACE::CreateDBStatistics();
+  Reopen(options);
+
+  const int kNumThreads = 8;
+  const int kNumWritesPerThread = 50;
+  std::vector<port::Thread> threads;
+  for (int t = 0; t < kNumThreads; t++) {
+    threads.emplace_back([&, t]() {
+      WriteOptions wo;
+      wo.sync = (t % 2 == 0);
+      for (int i = 0; i < kNumWritesPerThread; i++) {
+        ASSERT_OK(dbfull()->Put(wo, Key(t * kNumWritesPerThread + i),
+                                "value" + std::to_string(i)));
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  for (int t = 0; t < kNumThreads; t++) {
+    for (int i = 0; i < kNumWritesPerThread; i++) {
+      ASSERT_EQ("value" + std::to_string(i),
+                Get(Key(t * kNumWritesPerThread + i)));
+    }
+  }
+
+  // Every write belongs to exactly one recorded write group
+  HistogramData group_sizes;
+  options.statistics->histogramData(WRITE_GROUP_SIZE, &group_sizes);
+  ASSERT_EQ(static_cast<uint64_t>(kNumThreads * kNumWritesPerThread),
+            group_sizes.sum);
+  ASSERT_EQ(options.statistics->getTickerCount(WRITE_DONE_BY_SELF),
+            group_sizes.count);
+}
+
 INSTANTIATE_TEST_CASE_P(DBWriteTestInstance, DBWriteTest,
                         testing::Values(DBTestBase::kDefault,
                                         DBTestBase::kConcurrentWALWrites,
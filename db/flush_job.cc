@@ -11,9 +11,11 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <unordered_set>
 #include <vector>
 
 #include "db/builder.h"
+#include "db/compaction/clipping_iterator.h"
 #include "db/db_iter.h"
 #include "db/dbformat.h"
 #include "db/event_helpers.h"
@@ -36,6 +38,7 @@
 #include "port/port.h"
 #include "rocksdb/db.h"
 #include "rocksdb/env.h"
+#include "rocksdb/memtablerep.h"
 #include "rocksdb/statistics.h"
 #include "rocksdb/status.h"
 #include "rocksdb/table.h"
@@ -809,6 +812,76 @@ bool FlushJob::MemPurgeDecider(double threshold) {
           threshold);
 }
 
+namespace {
+// Each flush partition is expected to hold at least this much memtable data
+constexpr uint64_t kMinFlushPartitionBytes = 1 << 20;
+// Number of user keys sampled per partition to pick the boundaries
+constexpr uint64_t kFlushPartitionSamples = 64;
+
+// Returns up to `num_partitions - 1` distinct user keys, in order, that
+// split the entries of `mems` into ranges of roughly equal size. The keys
+// are picked from a random sample of the memtable entries.
+std::vector<std::string> GetFlushPartitionBoundaries(
+    const autovector<MemTable*>& mems, const Comparator* ucmp,
+    uint32_t num_partitions) {
+  std::vector<std::string> samples;
+  for (MemTable* m : mems) {
+    if (m->num_entries() == 0) {
+      continue;
+    }
+    std::unordered_set<const char*> entries;
+    m->UniqueRandomSample(std::min<uint64_t>(m->num_entries(),
+                                             kFlushPartitionSamples *
+                                                 num_partitions),
+                          &entries);
+    for (const char* entry : entries) {
+      samples.push_back(
+          ExtractUserKey(GetLengthPrefixedSlice(entry)).ToString());
+    }
+  }
+  std::sort(samples.begin(), samples.end(),
+            [ucmp](const std::string& a, const std::string& b) {
+              return ucmp->Compare(a, b) < 0;
+            });
+  samples.erase(std::unique(samples.begin(), samples.end(),
+                            [ucmp](const std::string& a, const std::string& b) {
+                              return ucmp->Equal(a, b);
+                            }),
+                samples.end());
+
+  std::vector<std::string> boundaries;
+  if (samples.size() < num_partitions) {
+    return boundaries;
+  }
+  for (uint32_t i = 1; i < num_partitions; i++) {
+    boundaries.push_back(std::move(samples[i * samples.size() /
+                                           num_partitions]));
+  }
+  return boundaries;
+}
+}  // anonymous namespace
+
+uint32_t FlushJob::GetNumFlushPartitions(uint64_t total_data_size) const {
+  const ImmutableCFOptions& ioptions = *cfd_->ioptions();
+  if (ioptions.max_flush_partitions <= 1 || db_options_.atomic_flush ||
+      mutable_cf_options_.enable_blob_files ||
+      cfd_->user_comparator()->timestamp_size() > 0) {
+    return 1;
+  }
+  // Boundaries are picked by sampling the memtables, which only some
+  // memtable representations support.
+  const MemTableRepFactory* factory = ioptions.memtable_factory.get();
+  if (factory == nullptr ||
+      !(factory->IsInstanceOf(SkipListFactory::kClassName()) ||
+        factory->IsInstanceOf(BTreeRepFactory::kClassName()))) {
+    return 1;
+  }
+  return static_cast<uint32_t>(
+      std::max<uint64_t>(1, std::min<uint64_t>(ioptions.max_flush_partitions,
+                                               total_data_size /
+                                                   kMinFlushPartitionBytes)));
+}
+
 Status FlushJob::WriteLevel0Table() {
   AutoThreadOperationStageUpdater stage_updater(
       ThreadStatus::STAGE_FLUSH_WRITE_L0);
@@ -913,37 +986,142 @@ Status FlushJob::WriteLevel0Table() {
       meta_.oldest_ancester_time = oldest_ancester_time;
       meta_.file_creation_time = current_time;
 
-      uint64_t num_input_entries = 0;
-      uint64_t memtable_payload_bytes = 0;
-      uint64_t memtable_garbage_bytes = 0;
-      IOStatus io_s;
-
       const std::string* const full_history_ts_low =
           (full_history_ts_low_.empty()) ? nullptr : &full_history_ts_low_;
-      TableBuilderOptions tboptions(
-          *cfd_->ioptions(), mutable_cf_options_, cfd_->internal_comparator(),
-          cfd_->int_tbl_prop_collector_factories(), output_compression_,
-          mutable_cf_options_.compression_opts, cfd_->GetID(), cfd_->GetName(),
-          0 /* level */, false /* is_bottommost */,
-          TableFileCreationReason::kFlush, oldest_key_time, current_time,
-          db_id_, db_session_id_, 0 /* target_file_size */,
-          meta_.fd.GetNumber());
       const SequenceNumber job_snapshot_seq =
           job_context_->GetJobSnapshotSequence();
-      s = BuildTable(
-          dbname_, versions_, db_options_, tboptions, file_options_,
-          cfd_->table_cache(), iter.get(), std::move(range_del_iters), &meta_,
-          &blob_file_additions, existing_snapshots_,
-          earliest_write_conflict_snapshot_, job_snapshot_seq,
-          snapshot_checker_, mutable_cf_options_.paranoid_file_checks,
-          cfd_->internal_stats(), &io_s, io_tracer_,
-          BlobFileCreationReason::kFlush, seqno_to_time_mapping_, event_logger_,
-          job_context_->job_id, io_priority, &table_properties_, write_hint,
-          full_history_ts_low, blob_callback_, base_, &num_input_entries,
-          &memtable_payload_bytes, &memtable_garbage_bytes);
+      auto build_table =
+          [&](InternalIterator* input,
+              std::vector<std::unique_ptr<FragmentedRangeTombstoneIterator>>
+                  range_dels,
+              FileMetaData* meta, std::vector<BlobFileAddition>* blob_additions,
+              TableProperties* table_properties, IOStatus* io_s,
+              uint64_t* num_input_entries, uint64_t* memtable_payload_bytes,
+              uint64_t* memtable_garbage_bytes) {
+            TableBuilderOptions tboptions(
+                *cfd_->ioptions(), mutable_cf_options_,
+                cfd_->internal_comparator(),
+                cfd_->int_tbl_prop_collector_factories(), output_compression_,
+                mutable_cf_options_.compression_opts, cfd_->GetID(),
+                cfd_->GetName(), 0 /* level */, false /* is_bottommost */,
+                TableFileCreationReason::kFlush, oldest_key_time, current_time,
+                db_id_, db_session_id_, 0 /* target_file_size */,
+                meta->fd.GetNumber());
+            return BuildTable(
+                dbname_, versions_, db_options_, tboptions, file_options_,
+                cfd_->table_cache(), input, std::move(range_dels), meta,
+                blob_additions, existing_snapshots_,
+                earliest_write_conflict_snapshot_, job_snapshot_seq,
+                snapshot_checker_, mutable_cf_options_.paranoid_file_checks,
+                cfd_->internal_stats(), io_s, io_tracer_,
+                BlobFileCreationReason::kFlush, seqno_to_time_mapping_,
+                event_logger_, job_context_->job_id, io_priority,
+                table_properties, write_hint, full_history_ts_low,
+                blob_callback_, base_, num_input_entries,
+                memtable_payload_bytes, memtable_garbage_bytes);
+          };
+
+      // Split the key range into partitions that are built into separate
+      // files in parallel. Partition i covers the user keys in
+      // [bounds[i - 1], bounds[i]), with the first and last partitions
+      // unbounded below and above.
+      std::vector<InternalKey> bounds;
+      if (range_del_iters.empty()) {
+        const uint32_t max_partitions =
+            GetNumFlushPartitions(total_data_size);
+        if (max_partitions > 1) {
+          for (std::string& user_key : GetFlushPartitionBoundaries(
+                   mems_, cfd_->user_comparator(), max_partitions)) {
+            bounds.emplace_back(user_key, kMaxSequenceNumber,
+                                kValueTypeForSeek);
+          }
+        }
+      }
+      partition_metas_.resize(bounds.size());
+      for (FileMetaData& partition_meta : partition_metas_) {
+        partition_meta.fd = FileDescriptor(versions_->NewFileNumber(), 0, 0);
+        partition_meta.epoch_number = meta_.epoch_number;
+        partition_meta.oldest_ancester_time = meta_.oldest_ancester_time;
+        partition_meta.file_creation_time = meta_.file_creation_time;
+      }
+
+      struct PartitionResult {
+        Status status;
+        IOStatus io_status;
+        uint64_t num_input_entries = 0;
+        uint64_t memtable_payload_bytes = 0;
+        uint64_t memtable_garbage_bytes = 0;
+      };
+      std::vector<PartitionResult> partition_results(bounds.size());
+      std::vector<port::Thread> partition_threads;
+      partition_threads.reserve(bounds.size());
+      for (size_t i = 0; i < bounds.size(); i++) {
+        partition_threads.emplace_back([&, i]() {
+          PartitionResult& result = partition_results[i];
+          // Every partition reads the memtables through its own iterators
+          Arena partition_arena;
+          std::vector<InternalIterator*> partition_memtables;
+          for (MemTable* m : mems_) {
+            partition_memtables.push_back(m->NewIterator(ro, &partition_arena));
+          }
+          ScopedArenaIterator partition_iter(NewMergingIterator(
+              &cfd_->internal_comparator(), partition_memtables.data(),
+              static_cast<int>(partition_memtables.size()), &partition_arena));
+          const Slice start = bounds[i].Encode();
+          Slice limit;
+          if (i + 1 < bounds.size()) {
+            limit = bounds[i + 1].Encode();
+          }
+          ClippingIterator clipped_iter(
+              partition_iter.get(), &start,
+              i + 1 < bounds.size() ? &limit : nullptr,
+              &cfd_->internal_comparator());
+          std::vector<BlobFileAddition> partition_blob_file_additions;
+          TableProperties partition_table_properties;
+          result.status = build_table(
+              &clipped_iter, {}, &partition_metas_[i],
+              &partition_blob_file_additions, &partition_table_properties,
+              &result.io_status, &result.num_input_entries,
+              &result.memtable_payload_bytes, &result.memtable_garbage_bytes);
+        });
+      }
+
+      uint64_t num_input_entries = 0;
+      uint64_t memtable_payload_bytes = 0;
+      uint64_t memtable_garbage_bytes = 0;
+      IOStatus io_s;
+      if (bounds.empty()) {
+        s = build_table(iter.get(), std::move(range_del_iters), &meta_,
+                        &blob_file_additions, &table_properties_, &io_s,
+                        &num_input_entries, &memtable_payload_bytes,
+                        &memtable_garbage_bytes);
+      } else {
+        const Slice limit = bounds.front().Encode();
+        ClippingIterator clipped_iter(iter.get(), nullptr /* start */, &limit,
+                                      &cfd_->internal_comparator());
+        s = build_table(&clipped_iter, std::move(range_del_iters), &meta_,
+                        &blob_file_additions, &table_properties_, &io_s,
+                        &num_input_entries, &memtable_payload_bytes,
+                        &memtable_garbage_bytes);
+      }
+      for (port::Thread& thread : partition_threads) {
+        thread.join();
+      }
       // TODO: Cleanup io_status in BuildTable and table builders
       assert(!s.ok() || io_s.ok());
       io_s.PermitUncheckedError();
+      for (PartitionResult& result : partition_results) {
+        assert(!result.status.ok() || result.io_status.ok());
+        result.io_status.PermitUncheckedError();
+        if (s.ok()) {
+          s = result.status;
+        } else {
+          result.status.PermitUncheckedError();
+        }
+        num_input_entries += result.num_input_entries;
+        memtable_payload_bytes += result.memtable_payload_bytes;
+        memtable_garbage_bytes += result.memtable_garbage_bytes;
+      }
       if (num_input_entries != total_num_entries && s.ok()) {
         std::string msg = "Expected " + std::to_string(total_num_entries) +
                           " entries in memtables, but read " +
@@ -955,13 +1133,11 @@ Status FlushJob::WriteLevel0Table() {
           s = Status::Corruption(msg);
         }
       }
-      if (tboptions.reason == TableFileCreationReason::kFlush) {
-        TEST_SYNC_POINT("DBImpl::FlushJob:Flush");
-        RecordTick(stats_, MEMTABLE_PAYLOAD_BYTES_AT_FLUSH,
-                   memtable_payload_bytes);
-        RecordTick(stats_, MEMTABLE_GARBAGE_BYTES_AT_FLUSH,
-                   memtable_garbage_bytes);
-      }
+      TEST_SYNC_POINT("DBImpl::FlushJob:Flush");
+      RecordTick(stats_, MEMTABLE_PAYLOAD_BYTES_AT_FLUSH,
+                 memtable_payload_bytes);
+      RecordTick(stats_, MEMTABLE_GARBAGE_BYTES_AT_FLUSH,
+                 memtable_garbage_bytes);
       LogFlush(db_options_.info_log);
     }
     ROCKS_LOG_BUFFER(log_buffer_,
@@ -972,6 +1148,17 @@ Status FlushJob::WriteLevel0Table() {
                      meta_.fd.GetNumber(), meta_.fd.GetFileSize(),
                      s.ToString().c_str(),
                      meta_.marked_for_compaction ? " (needs compaction)" : "");
+    for (const FileMetaData& partition_meta : partition_metas_) {
+      ROCKS_LOG_BUFFER(log_buffer_,
+                       "[%s] [JOB %d] Level-0 flush partition table #%" PRIu64
+                       ": %" PRIu64 " bytes%s",
+                       cfd_->GetName().c_str(), job_context_->job_id,
+                       partition_meta.fd.GetNumber(),
+                       partition_meta.fd.GetFileSize(),
+                       partition_meta.marked_for_compaction
+                           ? " (needs compaction)"
+                           : "");
+    }
 
     if (s.ok() && output_file_directory_ != nullptr && sync_output_directory_) {
       s = output_file_directory_->FsyncWithDirOptions(
@@ -986,6 +1173,8 @@ Status FlushJob::WriteLevel0Table() {
   // Note that if file_size is zero, the file has been deleted and
   // should not be added to the manifest.
   const bool has_output = meta_.fd.GetFileSize() > 0;
+  uint64_t num_output_files = has_output ? 1 : 0;
+  uint64_t output_bytes = meta_.fd.GetFileSize();
 
   if (s.ok() && has_output) {
     TEST_SYNC_POINT("DBImpl::FlushJob:SSTFileCreated");
@@ -1004,6 +1193,29 @@ Status FlushJob::WriteLevel0Table() {
                    meta_.unique_id, meta_.compensated_range_deletion_size);
     edit_->SetBlobFileAdditions(std::move(blob_file_additions));
   }
+  for (const FileMetaData& partition_meta : partition_metas_) {
+    if (!s.ok() || partition_meta.fd.GetFileSize() == 0) {
+      continue;
+    }
+    // The partitions do not overlap each other, so they can share the
+    // epoch number of the flush.
+    edit_->AddFile(0 /* level */, partition_meta.fd.GetNumber(),
+                   partition_meta.fd.GetPathId(),
+                   partition_meta.fd.GetFileSize(), partition_meta.smallest,
+                   partition_meta.largest, partition_meta.fd.smallest_seqno,
+                   partition_meta.fd.largest_seqno,
+                   partition_meta.marked_for_compaction,
+                   partition_meta.temperature,
+                   partition_meta.oldest_blob_file_number,
+                   partition_meta.oldest_ancester_time,
+                   partition_meta.file_creation_time,
+                   partition_meta.epoch_number, partition_meta.file_checksum,
+                   partition_meta.file_checksum_func_name,
+                   partition_meta.unique_id,
+                   partition_meta.compensated_range_deletion_size);
+    num_output_files++;
+    output_bytes += partition_meta.fd.GetFileSize();
+  }
   // Piggyback FlushJobInfo on the first first flushed memtable.
   mems_[0]->SetFlushJobInfo(GetFlushJobInfo());
 
@@ -1020,10 +1232,8 @@ Status FlushJob::WriteLevel0Table() {
                  cfd_->GetName().c_str(), job_context_->job_id, micros,
                  cpu_micros);
 
-  if (has_output) {
-    stats.bytes_written = meta_.fd.GetFileSize();
-    stats.num_output_files = 1;
-  }
+  stats.bytes_written = output_bytes;
+  stats.num_output_files = static_cast<int>(num_output_files);
 
   const auto& blobs = edit_->GetBlobFileAdditions();
   for (const auto& blob : blobs) {
@@ -89,6 +89,12 @@ class FlushJob {
   void Cancel();
   const autovector<MemTable*>& GetMemTables() const { return mems_; }
 
+  // Files built besides the one passed to Run() when the flush was split
+  // into several partitions. See `max_flush_partitions`.
+  const std::vector<FileMetaData>& GetPartitionOutputs() const {
+    return partition_metas_;
+  }
+
   std::list<std::unique_ptr<FlushJobInfo>>* GetCommittedFlushJobsInfo() {
     return &committed_flush_jobs_info_;
   }
@@ -100,6 +106,9 @@ class FlushJob {
   void ReportFlushInputSize(const autovector<MemTable*>& mems);
   void RecordFlushIOStats();
   Status WriteLevel0Table();
+  // Number of partitions a flush of `total_data_size` bytes of memtable data
+  // may be split into.
+  uint32_t GetNumFlushPartitions(uint64_t total_data_size) const;
 
   // Memtable Garbage Collection algorithm: a MemPurge takes the list
   // of immutable memtables and filters out (or "purge") the outdated bytes
@@ -179,6 +188,9 @@ class FlushJob {
 
   // Variables below are set by PickMemTable():
   FileMetaData meta_;
+  // Set by WriteLevel0Table() for the partitions other than the first one,
+  // which is built into meta_.
+  std::vector<FileMetaData> partition_metas_;
   autovector<MemTable*> mems_;
   VersionEdit* edit_;
   Version* base_;
@@ -251,6 +251,7 @@ static const std::string cf_file_histogram = "cf-file-histogram";
 static const std::string cf_write_stall_stats = "cf-write-stall-stats";
 static const std::string dbstats = "dbstats";
 static const std::string db_write_stall_stats = "db-write-stall-stats";
+static const std::string db_write_stage_stats = "db-write-stage-stats";
 static const std::string levelstats = "levelstats";
 static const std::string block_cache_entry_stats = "block-cache-entry-stats";
 static const std::string fast_block_cache_entry_stats =
@@ -334,6 +335,8 @@ const std::string DB::Properties::kCFWriteStallStats =
     rocksdb_prefix + cf_write_stall_stats;
 const std::string DB::Properties::kDBWriteStallStats =
     rocksdb_prefix + db_write_stall_stats;
+const std::string DB::Properties::kDBWriteStageStats =
+    rocksdb_prefix + db_write_stage_stats;
 const std::string DB::Properties::kDBStats = rocksdb_prefix + dbstats;
 const std::string DB::Properties::kLevelStats = rocksdb_prefix + levelstats;
 const std::string DB::Properties::kBlockCacheEntryStats =
@@ -470,6 +473,9 @@ const UnorderedMap<std::string, DBPropertyInfo>
         {DB::Properties::kDBWriteStallStats,
          {false, &InternalStats::HandleDBWriteStallStats, nullptr,
           &InternalStats::HandleDBWriteStallStatsMap, nullptr}},
+        {DB::Properties::kDBWriteStageStats,
+         {true, &InternalStats::HandleDBWriteStageStats, nullptr,
+          &InternalStats::HandleDBWriteStageStatsMap, nullptr}},
         {DB::Properties::kBlockCacheEntryStats,
          {true, &InternalStats::HandleBlockCacheEntryStats, nullptr,
           &InternalStats::HandleBlockCacheEntryStatsMap, nullptr}},
@@ -1139,6 +1145,61 @@ bool InternalStats::HandleDBWriteStallStatsMap(
   return true;
 }
 
+namespace {
+// Stages of the write path reported by kDBWriteStageStats, in the order a
+// write goes through them, with the histograms of their latencies
+const std::vector<std::pair<std::string, Histograms>> kWriteStageHistograms = {
+    {"join_group", WRITE_JOIN_GROUP_MICROS},
+    {"form_group", WRITE_FORM_GROUP_MICROS},
+    {"delay", WRITE_STALL},
+    {"wal", WRITE_WAL_MICROS},
+    {"wal_sync", WAL_FILE_SYNC_MICROS},
+    {"memtable", WRITE_MEMTABLE_MICROS},
+    {"callback", WRITE_CALLBACK_MICROS},
+};
+}  // namespace
+
+bool InternalStats::HandleDBWriteStageStats(std::string* value,
+                                            Slice /*suffix*/) {
+  Statistics* statistics = cfd_->ioptions()->stats;
+  if (statistics == nullptr) {
+    return false;
+  }
+  char buf[200];
+  snprintf(buf, sizeof(buf), "%-12s %12s %12s %12s %12s %12s\n",
+           "Write stage", "Count", "Avg(us)", "P50(us)", "P99(us)",
+           "Max(us)");
+  value->append(buf);
+  for (const auto& stage : kWriteStageHistograms) {
+    HistogramData data;
+    statistics->histogramData(stage.second, &data);
+    snprintf(buf, sizeof(buf),
+             "%-12s %12" PRIu64 " %12.1f %12.1f %12.1f %12.1f\n",
+             stage.first.c_str(), data.count, data.average, data.median,
+             data.percentile99, data.max);
+    value->append(buf);
+  }
+  return true;
+}
+
+bool InternalStats::HandleDBWriteStageStatsMap(
+    std::map<std::string, std::string>* values, Slice /*suffix*/) {
+  Statistics* statistics = cfd_->ioptions()->stats;
+  if (statistics == nullptr) {
+    return false;
+  }
+  for (const auto& stage : kWriteStageHistograms) {
+    HistogramData data;
+    statistics->histogramData(stage.second, &data);
+    (*values)[stage.first + ".count"] = std::to_string(data.count);
+    (*values)[stage.first + ".average"] = std::to_string(data.average);
+    (*values)[stage.first + ".p50"] = std::to_string(data.median);
+    (*values)[stage.first + ".p99"] = std::to_string(data.percentile99);
+    (*values)[stage.first + ".max"] = std::to_string(data.max);
+  }
+  return true;
+}
+
 bool InternalStats::HandleSsTables(std::string* value, Slice /*suffix*/) {
   auto* current = cfd_->current();
   *value = current->DebugString(true, true);
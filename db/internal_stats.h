@@ -775,6 +775,9 @@ class InternalStats {
   bool HandleDBWriteStallStats(std::string* value, Slice suffix);
   bool HandleDBWriteStallStatsMap(std::map<std::string, std::string>* values,
                                   Slice suffix);
+  bool HandleDBWriteStageStats(std::string* value, Slice suffix);
+  bool HandleDBWriteStageStatsMap(std::map<std::string, std::string>* values,
+                                  Slice suffix);
   bool HandleSsTables(std::string* value, Slice suffix);
   bool HandleAggregatedTableProperties(std::string* value, Slice suffix);
   bool HandleAggregatedTablePropertiesAtLevel(std::string* value, Slice suffix);
@@ -563,6 +563,10 @@ void Reader::InitCompression(const CompressionTypeRecord& compression_record) {
   uncompress_ = StreamingUncompress::Create(
       compression_type_, compression_format_version, kBlockSize);
   assert(uncompress_ != nullptr);
+  const std::string& dict = compression_record.GetDictionary();
+  if (!dict.empty() && !uncompress_->LoadDictionary(dict)) {
+    ReportCorruption(dict.size(), "could not load WAL compression dictionary");
+  }
   uncompressed_buffer_ = std::unique_ptr<char[]>(new char[kBlockSize]);
   assert(uncompressed_buffer_);
 }
@@ -1011,6 +1011,40 @@ TEST_P(CompressionLogTest, AlignedFragmentation) {
   ASSERT_EQ("EOF", Read());
 }
 
+TEST_P(CompressionLogTest, Dictionary) {
+  CompressionType compression_type = std::get<2>(GetParam());
+  if (!StreamingCompressionTypeSupported(compression_type)) {
+    ROCKSDB_GTEST_SKIP("Test requires support for compression type");
+    return;
+  }
+  Random rnd(301);
+  std::string dict = rnd.RandomBinaryString(8 << 10);
+  ASSERT_OK(writer_->AddCompressionTypeRecord(dict));
+  const size_t header_bytes = WrittenBytes();
+  if (compression_type != kNoCompression) {
+    ASSERT_GT(header_bytes, dict.size());
+  }
+
+  // Incompressible on their own, but found in the dictionary
+  const std::vector<std::string> wal_entries = {
+      dict.substr(100, 200),
+      dict.substr(4000, 3000),
+      "not in the dictionary",
+      dict.substr(0, 1000) + dict.substr(7000, 1000),
+  };
+  for (const std::string& wal_entry : wal_entries) {
+    Write(wal_entry);
+  }
+  if (compression_type != kNoCompression) {
+    ASSERT_LT(WrittenBytes() - header_bytes, 1000);
+  }
+
+  for (const std::string& wal_entry : wal_entries) {
+    ASSERT_EQ(wal_entry, Read());
+  }
+  ASSERT_EQ("EOF", Read());
+}
+
 INSTANTIATE_TEST_CASE_P(
     Compression, CompressionLogTest,
     ::testing::Combine(::testing::Values(0, 1), ::testing::Bool(),
@@ -11,6 +11,8 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+
 #include "file/writable_file_writer.h"
 #include "rocksdb/env.h"
 #include "rocksdb/io_status.h"
@@ -22,14 +24,17 @@ namespace log {
 
 Writer::Writer(std::unique_ptr<WritableFileWriter>&& dest, uint64_t log_number,
                bool recycle_log_files, bool manual_flush,
-               CompressionType compression_type)
+               CompressionType compression_type,
+               size_t max_compression_dict_bytes)
     : dest_(std::move(dest)),
       block_offset_(0),
       log_number_(log_number),
       recycle_log_files_(recycle_log_files),
       manual_flush_(manual_flush),
       compression_type_(compression_type),
-      compress_(nullptr) {
+      compress_(nullptr),
+      max_compression_dict_bytes_(
+          std::min(max_compression_dict_bytes, kMaxCompressionDictBytes)) {
   for (int i = 0; i <= kMaxRecordType; i++) {
     char t = static_cast<char>(i);
     type_crc_[i] = crc32c::Value(&t, 1);
@@ -153,11 +158,24 @@ IOStatus Writer::AddRecord(const Slice& slice,
       s = dest_->Flush(rate_limiter_priority);
     }
   }
+  if (compress_ && max_compression_dict_bytes_ > 0) {
+    size_t n = std::min(slice.size(), max_compression_dict_bytes_);
+    recent_record_data_.append(slice.data() + slice.size() - n, n);
+    if (recent_record_data_.size() > 2 * max_compression_dict_bytes_) {
+      recent_record_data_.erase(
+          0, recent_record_data_.size() - max_compression_dict_bytes_);
+    }
+  }
 
   return s;
 }
 
-IOStatus Writer::AddCompressionTypeRecord() {
+Slice Writer::RecentRecordData() const {
+  size_t n = std::min(recent_record_data_.size(), max_compression_dict_bytes_);
+  return Slice(recent_record_data_.data() + recent_record_data_.size() - n, n);
+}
+
+IOStatus Writer::AddCompressionTypeRecord(const Slice& compression_dict) {
   // Should be the first record
   assert(block_offset_ == 0);
 
@@ -166,7 +184,34 @@ IOStatus Writer::AddCompressionTypeRecord() {
     return IOStatus::OK();
   }
 
-  CompressionTypeRecord record(compression_type_);
+  // Initialize fields required for compression
+  const size_t max_output_buffer_len =
+      kBlockSize - (recycle_log_files_ ? kRecyclableHeaderSize : kHeaderSize);
+  CompressionOptions opts;
+  constexpr uint32_t compression_format_version = 2;
+  compress_ = StreamingCompress::Create(compression_type_, opts,
+                                        compression_format_version,
+                                        max_output_buffer_len);
+  assert(compress_ != nullptr);
+  compressed_buffer_ = std::unique_ptr<char[]>(new char[max_output_buffer_len]);
+  assert(compressed_buffer_);
+
+  Slice dict = compression_dict;
+  if (dict.size() > kMaxCompressionDictBytes) {
+    dict.remove_prefix(dict.size() - kMaxCompressionDictBytes);
+  }
+  // Data starting with the zstd dictionary magic number would be loaded as
+  // a structured dictionary rather than as raw content.
+  constexpr uint32_t kZstdDictMagic = 0xEC30A437;
+  if (dict.size() >= sizeof(uint32_t) &&
+      DecodeFixed32(dict.data()) == kZstdDictMagic) {
+    dict.remove_prefix(1);
+  }
+  if (!dict.empty() && !compress_->LoadDictionary(dict)) {
+    dict = Slice();
+  }
+
+  CompressionTypeRecord record(compression_type_, dict);
   std::string encode;
   record.EncodeTo(&encode);
   IOStatus s =
@@ -175,21 +220,11 @@ IOStatus Writer::AddCompressionTypeRecord() {
     if (!manual_flush_) {
       s = dest_->Flush();
     }
-    // Initialize fields required for compression
-    const size_t max_output_buffer_len =
-        kBlockSize - (recycle_log_files_ ? kRecyclableHeaderSize : kHeaderSize);
-    CompressionOptions opts;
-    constexpr uint32_t compression_format_version = 2;
-    compress_ = StreamingCompress::Create(compression_type_, opts,
-                                          compression_format_version,
-                                          max_output_buffer_len);
-    assert(compress_ != nullptr);
-    compressed_buffer_ =
-        std::unique_ptr<char[]>(new char[max_output_buffer_len]);
-    assert(compressed_buffer_);
   } else {
     // Disable compression if the record could not be added.
     compression_type_ = kNoCompression;
+    delete compress_;
+    compress_ = nullptr;
   }
   return s;
 }
@@ -73,10 +73,13 @@ class Writer {
   // Create a writer that will append data to "*dest".
   // "*dest" must be initially empty.
   // "*dest" must remain live while this Writer is in use.
+  // With compression, the most recent max_compression_dict_bytes of record
+  // data are kept for priming the compression of the next log.
   explicit Writer(std::unique_ptr<WritableFileWriter>&& dest,
                   uint64_t log_number, bool recycle_log_files,
                   bool manual_flush = false,
-                  CompressionType compressionType = kNoCompression);
+                  CompressionType compressionType = kNoCompression,
+                  size_t max_compression_dict_bytes = 0);
   // No copying allowed
   Writer(const Writer&) = delete;
   void operator=(const Writer&) = delete;
@@ -85,7 +88,17 @@ class Writer {
 
   IOStatus AddRecord(const Slice& slice,
                      Env::IOPriority rate_limiter_priority = Env::IO_TOTAL);
-  IOStatus AddCompressionTypeRecord();
+  // Writes the record setting the compression type (if any) for the
+  // following records. Up to kMaxCompressionDictBytes of compression_dict
+  // (e.g. RecentRecordData() of the previous log) are stored in the record
+  // and used as a raw content dictionary for the following records.
+  IOStatus AddCompressionTypeRecord(const Slice& compression_dict = Slice());
+
+  // The most recent data of records added to this log, up to
+  // max_compression_dict_bytes. Empty unless the log is compressed.
+  Slice RecentRecordData() const;
+
+  static constexpr size_t kMaxCompressionDictBytes = kBlockSize / 2;
 
   WritableFileWriter* file() { return dest_.get(); }
   const WritableFileWriter* file() const { return dest_.get(); }
@@ -122,6 +135,9 @@ class Writer {
   StreamingCompress* compress_;
   // Reusable compressed output buffer
   std::unique_ptr<char[]> compressed_buffer_;
+  const size_t max_compression_dict_bytes_;
+  // Holds at least the last max_compression_dict_bytes_ of record data
+  std::string recent_record_data_;
 };
 
 }  // namespace log
@@ -54,6 +54,10 @@ ImmutableMemTableOptions::ImmutableMemTableOptions(
               static_cast<double>(mutable_cf_options.write_buffer_size) *
               mutable_cf_options.memtable_prefix_bloom_size_ratio) *
           8u),
+      memtable_hash_index_buckets(static_cast<size_t>(
+          static_cast<double>(mutable_cf_options.write_buffer_size) *
+          mutable_cf_options.memtable_hash_index_size_ratio /
+          sizeof(void*))),
       memtable_huge_page_size(mutable_cf_options.memtable_huge_page_size),
       memtable_whole_key_filtering(
           mutable_cf_options.memtable_whole_key_filtering),
@@ -127,6 +131,15 @@ MemTable::MemTable(const InternalKeyComparator& cmp,
                          6 /* hard coded 6 probes */,
                          moptions_.memtable_huge_page_size, ioptions.logger));
   }
+  // The index matches user keys by their bytes, so it needs a comparator
+  // that only finds identical keys equal, and no timestamps.
+  if (moptions_.memtable_hash_index_buckets > 0 &&
+      comparator_.comparator.user_comparator()->timestamp_size() == 0 &&
+      !comparator_.comparator.user_comparator()
+           ->CanKeysWithDifferentByteContentsBeEqual()) {
+    hash_index_.reset(
+        new MemTableHashIndex(moptions_.memtable_hash_index_buckets, &arena_));
+  }
   // Initialize cached_range_tombstone_ here since it could
   // be read before it is constructed in MemTable::Add(), which could also lead
   // to a data race on the global mutex table backing atomic shared_ptr.
@@ -792,6 +805,9 @@ Status MemTable::Add(SequenceNumber s, ValueType type,
     if (bloom_filter_ && moptions_.memtable_whole_key_filtering) {
       bloom_filter_->Add(key_without_ts);
     }
+    if (hash_index_ && type != kTypeRangeDeletion) {
+      hash_index_->Insert(buf);
+    }
 
     // The first sequence number inserted into the memtable
     assert(first_seqno_ == 0 || s >= first_seqno_);
@@ -829,6 +845,9 @@ Status MemTable::Add(SequenceNumber s, ValueType type,
     if (bloom_filter_ && moptions_.memtable_whole_key_filtering) {
       bloom_filter_->AddConcurrently(key_without_ts);
     }
+    if (hash_index_ && type != kTypeRangeDeletion) {
+      hash_index_->Insert(buf);
+    }
 
     // atomically update first_seqno_ and earliest_seqno_.
     uint64_t cur_seq_num = first_seqno_.load(std::memory_order_relaxed);
@@ -1386,6 +1405,28 @@ void MemTable::GetFromTable(const LookupKey& key,
   saver.do_merge = do_merge;
   saver.allow_data_in_errors = moptions_.allow_data_in_errors;
   saver.protection_bytes_per_key = moptions_.protection_bytes_per_key;
+  if (hash_index_) {
+    const char* entry = hash_index_->Find(key.user_key());
+    if (entry == nullptr) {
+      // No version of the key is in this memtable
+      *seq = saver.seq;
+      return;
+    }
+    // The newest version answers the lookup by itself if it is visible and
+    // is not a merge operand. Otherwise SaveValue() may need the older
+    // versions, so search the rep.
+    if (callback == nullptr &&
+        MemTableHashIndex::EntryType(entry) != kTypeMerge &&
+        MemTableHashIndex::EntrySequence(entry) <=
+            GetInternalKeySeqno(key.internal_key())) {
+      TEST_SYNC_POINT("MemTable::GetFromTable:HashIndexHit");
+      const bool more = SaveValue(&saver, entry);
+      assert(!more);
+      (void)more;
+      *seq = saver.seq;
+      return;
+    }
+  }
   table_->Get(key, &saver, SaveValue);
   *seq = saver.seq;
 }
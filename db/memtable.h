@@ -23,6 +23,7 @@
 #include "db/version_edit.h"
 #include "memory/allocator.h"
 #include "memory/concurrent_arena.h"
+#include "memtable/memtable_hash_index.h"
 #include "monitoring/instrumented_mutex.h"
 #include "options/cf_options.h"
 #include "rocksdb/db.h"
@@ -45,6 +46,7 @@ struct ImmutableMemTableOptions {
                                     const MutableCFOptions& mutable_cf_options);
   size_t arena_block_size;
   uint32_t memtable_prefix_bloom_bits;
+  size_t memtable_hash_index_buckets;
   size_t memtable_huge_page_size;
   bool memtable_whole_key_filtering;
   bool inplace_update_support;
@@ -587,6 +589,9 @@ class MemTable {
 
   const SliceTransform* const prefix_extractor_;
   std::unique_ptr<DynamicBloom> bloom_filter_;
+  // Newest entry of each user key, for point lookups. Null unless
+  // memtable_hash_index_size_ratio is set.
+  std::unique_ptr<MemTableHashIndex> hash_index_;
 
   std::atomic<FlushStateEnum> flush_state_;
 
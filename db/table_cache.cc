@@ -607,6 +607,34 @@ Status TableCache::ApproximateKeyAnchors(
   return s;
 }
 
+Status TableCache::PrefetchFirstDataBlocks(
+    const ReadOptions& ro, const FileOptions& file_options,
+    const InternalKeyComparator& internal_comparator,
+    const FileMetaData& file_meta,
+    const std::shared_ptr<const SliceTransform>& prefix_extractor,
+    HistogramImpl* file_read_hist, bool skip_filters, int level) {
+  Status s;
+  TableReader* t = file_meta.fd.table_reader;
+  TypedHandle* handle = nullptr;
+  if (t == nullptr) {
+    s = FindTable(ro, file_options, internal_comparator, file_meta, &handle,
+                  prefix_extractor, false /* no_io */,
+                  true /* record_read_stats */, file_read_hist, skip_filters,
+                  level, true /* prefetch_index_and_filter_in_cache */,
+                  0 /* max_file_size_for_l0_meta_pin */, file_meta.temperature);
+    if (s.ok()) {
+      t = cache_.Value(handle);
+    }
+  }
+  if (s.ok() && t != nullptr) {
+    t->PrefetchFirstDataBlocks(ro);
+  }
+  if (handle != nullptr) {
+    cache_.Release(handle);
+  }
+  return s;
+}
+
 size_t TableCache::GetMemoryUsageByTableReader(
     const FileOptions& file_options,
     const InternalKeyComparator& internal_comparator,
@@ -191,6 +191,16 @@ class TableCache {
                                const FileMetaData& file_meta,
                                std::vector<TableReader::Anchor>& anchors);
 
+  // Opens the table (unless its reader is already cached) and hints it to
+  // prefetch its first data blocks ahead of a sequential scan. See
+  // TableReader::PrefetchFirstDataBlocks().
+  Status PrefetchFirstDataBlocks(
+      const ReadOptions& ro, const FileOptions& file_options,
+      const InternalKeyComparator& internal_comparator,
+      const FileMetaData& file_meta,
+      const std::shared_ptr<const SliceTransform>& prefix_extractor,
+      HistogramImpl* file_read_hist, bool skip_filters, int level);
+
   // Return total memory usage of the table reader of the file.
   // 0 if table reader of the file is not loaded.
   size_t GetMemoryUsageByTableReader(
@@ -215,6 +225,8 @@ class TableCache {
 
   CacheInterface& get_cache() { return cache_; }
 
+  const ImmutableOptions& ioptions() const { return ioptions_; }
+
   // Capacity of the backing Cache that indicates infinite TableCache capacity.
   // For example when max_open_files is -1 we set the backing Cache to this.
   static const int kInfiniteCapacity = 0x400000;
@@ -959,6 +959,7 @@ class LevelIterator final : public InternalIterator {
         skip_filters_(skip_filters),
         allow_unprepared_value_(allow_unprepared_value),
         file_index_(flevel_->num_files),
+        prefetched_file_index_(flevel_->num_files),
         level_(level),
         range_del_agg_(range_del_agg),
         pinned_iters_mgr_(nullptr),
@@ -1058,6 +1059,11 @@ class LevelIterator final : public InternalIterator {
   void SkipEmptyFileBackward();
   void SetFileIterator(InternalIterator* iter);
   void InitFileIterator(size_t new_file_index);
+  // With ReadOptions::async_io, a forward scan moving into the next file hints
+  // the file after it to read ahead its first data blocks, so the scan does
+  // not stall on a cold read when it gets there. Scans that stay within the
+  // file they seeked to never issue the hint.
+  void PrefetchNextFile();
 
   const Slice& file_smallest_key(size_t file_index) {
     assert(file_index < flevel_->num_files);
@@ -1143,6 +1149,8 @@ class LevelIterator final : public InternalIterator {
   bool allow_unprepared_value_;
   bool may_be_out_of_lower_bound_ = true;
   size_t file_index_;
+  // Index of the file last hinted by PrefetchNextFile(), or num_files if none
+  size_t prefetched_file_index_;
   int level_;
   RangeDelAggregator* range_del_agg_;
   IteratorWrapper file_iter_;  // May be nullptr
@@ -1442,6 +1450,7 @@ bool LevelIterator::SkipEmptyFileForward() {
     // LevelIterator::Seek*, it should also call Seek* into the corresponding
     // range tombstone iterator.
     if (file_iter_.iter() != nullptr) {
+      PrefetchNextFile();
       file_iter_.SeekToFirst();
       if (range_tombstone_iter_) {
         if (*range_tombstone_iter_) {
@@ -1503,6 +1512,33 @@ void LevelIterator::SetFileIterator(InternalIterator* iter) {
   }
 }
 
+void LevelIterator::PrefetchNextFile() {
+  if (!read_options_.async_io || caller_ != TableReaderCaller::kUserIterator ||
+      read_options_.read_tier == kBlockCacheTier) {
+    return;
+  }
+  RecordTick(table_cache_->ioptions().stats,
+             prefetched_file_index_ == file_index_
+                 ? LEVEL_ITER_NEXT_FILE_PREFETCH_HIT
+                 : LEVEL_ITER_NEXT_FILE_PREFETCH_MISS);
+
+  const size_t next_file_index = file_index_ + 1;
+  if (next_file_index >= flevel_->num_files ||
+      KeyReachedUpperBound(file_smallest_key(next_file_index))) {
+    return;
+  }
+  TEST_SYNC_POINT("LevelIterator::PrefetchNextFile");
+  // Failures are not fatal: the file is opened again, and any error
+  // reported, when the scan gets to it.
+  Status s = table_cache_->PrefetchFirstDataBlocks(
+      read_options_, file_options_, icomparator_,
+      *flevel_->files[next_file_index].file_metadata, prefix_extractor_,
+      file_read_hist_, skip_filters_, level_);
+  if (s.ok()) {
+    prefetched_file_index_ = next_file_index;
+  }
+}
+
 void LevelIterator::InitFileIterator(size_t new_file_index) {
   if (new_file_index >= flevel_->num_files) {
     file_index_ = new_file_index;
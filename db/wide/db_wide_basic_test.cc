@@ -210,6 +210,122 @@ TEST_F(DBWideBasicTest, PutEntity) {
   verify();
 }
 
+TEST_F(DBWideBasicTest, ColumnProjection) {
+  Options options = GetDefaultOptions();
+
+  constexpr char first_key[] = "first";
+  WideColumns first_columns{{kDefaultWideColumnName, "hello"},
+                            {"attr_name1", "foo"},
+                            {"attr_name2", "bar"},
+                            {"attr_name3", "baz"}};
+
+  constexpr char second_key[] = "second";
+  constexpr char second_value[] = "plain";
+
+  ASSERT_OK(db_->PutEntity(WriteOptions(), db_->DefaultColumnFamily(),
+                           first_key, first_columns));
+  ASSERT_OK(db_->Put(WriteOptions(), db_->DefaultColumnFamily(), second_key,
+                     second_value));
+
+  const std::vector<Slice> projection{kDefaultWideColumnName, "attr_name2",
+                                      "attr_name4"};
+  ReadOptions read_options;
+  read_options.column_projection = &projection;
+
+  const WideColumns expected_first_columns{{kDefaultWideColumnName, "hello"},
+                                           {"attr_name2", "bar"}};
+  const WideColumns expected_second_columns{
+      {kDefaultWideColumnName, second_value}};
+
+  auto verify = [&]() {
+    {
+      PinnableWideColumns result;
+      ASSERT_OK(db_->GetEntity(read_options, db_->DefaultColumnFamily(),
+                               first_key, &result));
+      ASSERT_EQ(result.columns(), expected_first_columns);
+    }
+
+    {
+      PinnableWideColumns result;
+      ASSERT_OK(db_->GetEntity(read_options, db_->DefaultColumnFamily(),
+                               second_key, &result));
+      ASSERT_EQ(result.columns(), expected_second_columns);
+    }
+
+    {
+      constexpr size_t num_keys = 2;
+
+      std::array<Slice, num_keys> keys{{first_key, second_key}};
+      std::array<PinnableWideColumns, num_keys> results;
+      std::array<Status, num_keys> statuses;
+
+      db_->MultiGetEntity(read_options, db_->DefaultColumnFamily(), num_keys,
+                          &keys[0], &results[0], &statuses[0]);
+
+      ASSERT_OK(statuses[0]);
+      ASSERT_EQ(results[0].columns(), expected_first_columns);
+
+      ASSERT_OK(statuses[1]);
+      ASSERT_EQ(results[1].columns(), expected_second_columns);
+    }
+
+    {
+      std::unique_ptr<Iterator> iter(db_->NewIterator(read_options));
+
+      iter->SeekToFirst();
+      ASSERT_TRUE(iter->Valid());
+      ASSERT_OK(iter->status());
+      ASSERT_EQ(iter->key(), first_key);
+      ASSERT_EQ(iter->value(), "hello");
+      ASSERT_EQ(iter->columns(), expected_first_columns);
+
+      iter->Next();
+      ASSERT_TRUE(iter->Valid());
+      ASSERT_OK(iter->status());
+      ASSERT_EQ(iter->key(), second_key);
+      ASSERT_EQ(iter->value(), second_value);
+      ASSERT_EQ(iter->columns(), expected_second_columns);
+
+      iter->Next();
+      ASSERT_FALSE(iter->Valid());
+      ASSERT_OK(iter->status());
+    }
+
+    {
+      // Columns outside the default column only
+      const std::vector<Slice> attr_only{"attr_name1", "attr_name3"};
+      ReadOptions attr_read_options;
+      attr_read_options.column_projection = &attr_only;
+
+      PinnableWideColumns result;
+      ASSERT_OK(db_->GetEntity(attr_read_options, db_->DefaultColumnFamily(),
+                               first_key, &result));
+
+      const WideColumns expected{{"attr_name1", "foo"}, {"attr_name3", "baz"}};
+      ASSERT_EQ(result.columns(), expected);
+
+      ASSERT_OK(db_->GetEntity(attr_read_options, db_->DefaultColumnFamily(),
+                               second_key, &result));
+      ASSERT_TRUE(result.columns().empty());
+    }
+  };
+
+  // Try reading from memtable
+  verify();
+
+  // Try reading after recovery
+  Close();
+  options.avoid_flush_during_recovery = true;
+  Reopen(options);
+
+  verify();
+
+  // Try reading from storage
+  ASSERT_OK(Flush());
+
+  verify();
+}
+
 TEST_F(DBWideBasicTest, PutEntityColumnFamily) {
   Options options = GetDefaultOptions();
   CreateAndReopenWithCF({"corinthian"}, options);
@@ -160,6 +160,36 @@ WideColumns::const_iterator WideColumnSerialization::Find(
   return it;
 }
 
+void WideColumnSerialization::Project(const std::vector<Slice>& projection,
+                                      WideColumns& columns) {
+  assert(std::is_sorted(projection.cbegin(), projection.cend(),
+                        [](const Slice& lhs, const Slice& rhs) {
+                          return lhs.compare(rhs) < 0;
+                        }));
+
+  // Both the columns and the projection are sorted, so a single merge-style
+  // pass is enough.
+  auto out = columns.begin();
+  auto it = projection.cbegin();
+
+  for (auto column = columns.begin(); column != columns.end(); ++column) {
+    while (it != projection.cend() && it->compare(column->name()) < 0) {
+      ++it;
+    }
+
+    if (it == projection.cend()) {
+      break;
+    }
+
+    if (*it == column->name()) {
+      *out = *column;
+      ++out;
+    }
+  }
+
+  columns.erase(out, columns.end());
+}
+
 Status WideColumnSerialization::GetValueOfDefaultColumn(Slice& input,
                                                         Slice& value) {
   WideColumns columns;
@@ -7,6 +7,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "rocksdb/rocksdb_namespace.h"
 #include "rocksdb/status.h"
@@ -54,6 +55,11 @@ class WideColumnSerialization {
                                           const Slice& column_name);
   static Status GetValueOfDefaultColumn(Slice& input, Slice& value);
 
+  // Removes the columns whose names do not appear in `projection`, which has
+  // to be sorted with no duplicates.
+  static void Project(const std::vector<Slice>& projection,
+                      WideColumns& columns);
+
   static constexpr uint32_t kCurrentVersion = 1;
 
  private:
@@ -329,6 +329,42 @@ TEST(WideColumnSerializationTest, DeserializeColumnsOutOfOrder) {
   ASSERT_TRUE(std::strstr(s.getState(), "order"));
 }
 
+TEST(WideColumnSerializationTest, Project) {
+  const WideColumns columns{{kDefaultWideColumnName, "0"},
+                            {"a", "1"},
+                            {"c", "3"},
+                            {"d", "4"},
+                            {"f", "6"}};
+
+  {
+    WideColumns projected = columns;
+    WideColumnSerialization::Project({"a", "b", "d", "g"}, projected);
+
+    const WideColumns expected{{"a", "1"}, {"d", "4"}};
+    ASSERT_EQ(projected, expected);
+  }
+
+  {
+    WideColumns projected = columns;
+    WideColumnSerialization::Project({kDefaultWideColumnName, "f"}, projected);
+
+    const WideColumns expected{{kDefaultWideColumnName, "0"}, {"f", "6"}};
+    ASSERT_EQ(projected, expected);
+  }
+
+  {
+    WideColumns projected = columns;
+    WideColumnSerialization::Project({"b", "e", "z"}, projected);
+    ASSERT_TRUE(projected.empty());
+  }
+
+  {
+    WideColumns projected = columns;
+    WideColumnSerialization::Project({}, projected);
+    ASSERT_TRUE(projected.empty());
+  }
+}
+
 }  // namespace ROCKSDB_NAMESPACE
 
 int main(int argc, char** argv) {
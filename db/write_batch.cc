@@ -261,6 +261,14 @@ void WriteBatch::Clear() {
   default_cf_ts_sz_ = 0;
 }
 
+void WriteBatch::Reserve(size_t bytes) {
+  // std::string::reserve() may shrink the buffer when given less than its
+  // capacity, which is not what callers pooling batches want.
+  if (bytes > rep_.capacity()) {
+    rep_.reserve(bytes);
+  }
+}
+
 uint32_t WriteBatch::Count() const { return WriteBatchInternal::Count(this); }
 
 uint32_t WriteBatch::ComputeContentFlags() const {
@@ -3119,6 +3127,7 @@ Status WriteBatchInternal::UpdateProtectionInfo(WriteBatch* wb,
   } else if (bytes_per_key == 8) {
     if (wb->prot_info_ == nullptr) {
       wb->prot_info_.reset(new WriteBatch::ProtectionInfo());
+      wb->prot_info_->entries_.reserve(Count(wb));
       ProtectionInfoUpdater prot_info_updater(wb->prot_info_.get());
       Status s = wb->Iterate(&prot_info_updater);
       if (s.ok() && checksum != nullptr) {
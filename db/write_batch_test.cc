@@ -909,6 +909,30 @@ TEST_F(WriteBatchTest, MemoryLimitTest) {
   ASSERT_TRUE(s.IsMemoryLimit());
 }
 
+TEST_F(WriteBatchTest, ReserveAndClearKeepCapacity) {
+  WriteBatch batch;
+  batch.Reserve(4096);
+  const size_t capacity = batch.Data().capacity();
+  ASSERT_GE(capacity, 4096);
+
+  ASSERT_OK(batch.Put("foo", std::string(1000, 'v')));
+  ASSERT_OK(batch.Delete("bar"));
+  ASSERT_EQ(capacity, batch.Data().capacity());
+
+  // Neither reserving less than the capacity nor clearing the batch should
+  // give memory back.
+  batch.Reserve(16);
+  ASSERT_EQ(capacity, batch.Data().capacity());
+  batch.Clear();
+  ASSERT_EQ(0u, batch.Count());
+  ASSERT_EQ(WriteBatchInternal::kHeader, batch.GetDataSize());
+  ASSERT_EQ(capacity, batch.Data().capacity());
+
+  ASSERT_OK(batch.Put("foo", "v2"));
+  ASSERT_EQ(1u, batch.Count());
+  ASSERT_EQ("Put(foo, v2)@0", PrintContents(&batch));
+}
+
 namespace {
 class TimestampChecker : public WriteBatch::Handler {
  public:
@@ -5,6 +5,7 @@
 
 #include "db/write_thread.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -16,6 +17,20 @@
 
 namespace ROCKSDB_NAMESPACE {
 
+namespace {
+// Weight of a new sample in the moving averages used for adaptive write group
+// sizing.
+constexpr double kAdaptiveGroupSampleWeight = 0.125;
+
+void UpdateMovingAverage(double sample, double* average) {
+  if (*average <= 0) {
+    *average = sample;
+  } else {
+    *average += (sample - *average) * kAdaptiveGroupSampleWeight;
+  }
+}
+}  // anonymous namespace
+
 WriteThread::WriteThread(const ImmutableDBOptions& db_options)
     : max_yield_usec_(db_options.enable_write_thread_adaptive_yield
                           ? db_options.write_thread_max_yield_usec
@@ -26,6 +41,9 @@ WriteThread::WriteThread(const ImmutableDBOptions& db_options)
       enable_pipelined_write_(db_options.enable_pipelined_write),
       max_write_batch_group_size_bytes(
           db_options.max_write_batch_group_size_bytes),
+      adaptive_write_group_size_(db_options.adaptive_write_group_size),
+      write_group_max_wait_usec_(db_options.write_group_max_wait_usec),
+      clock_(db_options.clock),
       newest_writer_(nullptr),
       newest_memtable_writer_(nullptr),
       last_sequence_(0),
@@ -447,7 +465,9 @@ size_t WriteThread::EnterAsBatchGroupLeader(Writer* leader,
   // down the small write too much.
   size_t max_size = max_write_batch_group_size_bytes;
   const uint64_t min_batch_size_bytes = max_write_batch_group_size_bytes / 8;
-  if (size <= min_batch_size_bytes) {
+  if (adaptive_write_group_size_) {
+    max_size = BeginAdaptiveWriteGroup(leader, size);
+  } else if (size <= min_batch_size_bytes) {
     max_size = size + min_batch_size_bytes;
   }
 
@@ -520,10 +540,72 @@ size_t WriteThread::EnterAsBatchGroupLeader(Writer* leader,
     write_group->last_writer = w;
     write_group->size++;
   }
+  if (adaptive_write_group_size_) {
+    UpdateMovingAverage(static_cast<double>(size) / write_group->size,
+                        &writer_bytes_);
+    last_group_size_ = write_group->size;
+    last_group_formed_micros_ = clock_->NowMicros();
+  }
   TEST_SYNC_POINT_CALLBACK("WriteThread::EnterAsBatchGroupLeader:End", w);
   return size;
 }
 
+size_t WriteThread::BeginAdaptiveWriteGroup(Writer* leader,
+                                            size_t leader_size) {
+  assert(adaptive_write_group_size_);
+  const uint64_t now = clock_->NowMicros();
+  if (last_group_size_ > 0) {
+    // In the long run, groups take in writers as fast as they arrive.
+    const uint64_t elapsed =
+        now > last_group_start_micros_ ? now - last_group_start_micros_ : 0;
+    UpdateMovingAverage(static_cast<double>(elapsed) / last_group_size_,
+                        &writer_arrival_micros_);
+  }
+  last_group_start_micros_ = now;
+  if (writer_arrival_micros_ <= 0 || group_write_micros_ <= 0) {
+    // No estimates yet, so stick to the default limit.
+    const uint64_t min_batch_size_bytes = max_write_batch_group_size_bytes / 8;
+    return leader_size <= min_batch_size_bytes
+               ? leader_size + min_batch_size_bytes
+               : max_write_batch_group_size_bytes;
+  }
+
+  // Writers that arrive while this group is being written have to wait for
+  // the next group, so aim to take in about that many.
+  const double expected_writers = group_write_micros_ / writer_arrival_micros_;
+
+  // A sync costs the same regardless of how many writers share it, so a
+  // sync leader may wait a little for writers that are about to arrive.
+  if (leader->sync && write_group_max_wait_usec_ > 0 &&
+      expected_writers >= 2 &&
+      writer_arrival_micros_ < write_group_max_wait_usec_) {
+    const size_t target = static_cast<size_t>(expected_writers);
+    const uint64_t wait_micros = std::min(
+        write_group_max_wait_usec_,
+        static_cast<uint64_t>(writer_arrival_micros_ * target));
+    TEST_SYNC_POINT("WriteThread::BeginAdaptiveWriteGroup:Wait");
+    while (CountPendingWriters(leader, target) < target &&
+           clock_->NowMicros() < now + wait_micros) {
+      std::this_thread::yield();
+    }
+  }
+
+  const double group_bytes =
+      leader_size + std::max(expected_writers, 1.0) * writer_bytes_ * 2;
+  return static_cast<size_t>(std::min(
+      group_bytes, static_cast<double>(max_write_batch_group_size_bytes)));
+}
+
+size_t WriteThread::CountPendingWriters(Writer* leader, size_t limit) {
+  size_t count = 0;
+  Writer* w = newest_writer_.load(std::memory_order_acquire);
+  while (w != leader && w != nullptr && count < limit) {
+    count++;
+    w = w->link_older;
+  }
+  return count;
+}
+
 void WriteThread::EnterAsMemTableWriter(Writer* leader,
                                         WriteGroup* write_group) {
   assert(leader != nullptr);
@@ -664,6 +746,13 @@ void WriteThread::ExitAsBatchGroupLeader(WriteGroup& write_group,
   TEST_SYNC_POINT_CALLBACK("WriteThread::ExitAsBatchGroupLeader:Start",
                            &write_group);
 
+  if (adaptive_write_group_size_) {
+    const uint64_t now = clock_->NowMicros();
+    const uint64_t elapsed =
+        now > last_group_formed_micros_ ? now - last_group_formed_micros_ : 0;
+    UpdateMovingAverage(static_cast<double>(elapsed), &group_write_micros_);
+  }
+
   Writer* leader = write_group.leader;
   Writer* last_writer = write_group.last_writer;
   assert(leader->link_older == nullptr);
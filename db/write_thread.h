@@ -21,6 +21,7 @@
 #include "monitoring/instrumented_mutex.h"
 #include "rocksdb/options.h"
 #include "rocksdb/status.h"
+#include "rocksdb/system_clock.h"
 #include "rocksdb/types.h"
 #include "rocksdb/write_batch.h"
 #include "util/autovector.h"
@@ -390,6 +391,23 @@ class WriteThread {
   // is larger than 1/8 of this limit.
   const uint64_t max_write_batch_group_size_bytes;
 
+  // See DBOptions::adaptive_write_group_size and write_group_max_wait_usec.
+  const bool adaptive_write_group_size_;
+  const uint64_t write_group_max_wait_usec_;
+  SystemClock* const clock_;
+
+  // Moving averages behind adaptive write group sizing: how long a batch
+  // group takes from being formed to its leader exiting, how much time passes
+  // per arriving writer, and how many bytes a writer adds. They are only
+  // accessed by the current batch group leader, which passes them on to the
+  // next leader together with the leadership.
+  double group_write_micros_ = 0;
+  double writer_arrival_micros_ = 0;
+  double writer_bytes_ = 0;
+  uint64_t last_group_start_micros_ = 0;
+  uint64_t last_group_formed_micros_ = 0;
+  size_t last_group_size_ = 0;
+
   // Points to the newest pending writer. Only leader can remove
   // elements, adding can be done lock-free by anybody.
   std::atomic<Writer*> newest_writer_;
@@ -452,6 +470,14 @@ class WriteThread {
   // concurrently with itself.
   void CreateMissingNewerLinks(Writer* head);
 
+  // With adaptive_write_group_size, updates the writer arrival estimate,
+  // lets a sync leader wait for the followers it expects, and returns the
+  // byte limit for the group led by a write of `leader_size` bytes.
+  size_t BeginAdaptiveWriteGroup(Writer* leader, size_t leader_size);
+
+  // Counts the writers queued behind the leader, stopping at `limit`.
+  size_t CountPendingWriters(Writer* leader, size_t limit);
+
   // Set the leader in write_group to completed state and remove it from the
   // write group.
   void CompleteLeader(WriteGroup& write_group);
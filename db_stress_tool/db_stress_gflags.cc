@@ -558,6 +558,11 @@ DEFINE_int32(
         ROCKSDB_NAMESPACE::BlockBasedTableOptions().data_block_index_type),
     "Index type for data blocks (see `enum DataBlockIndexType` in table.h)");
 
+DEFINE_bool(index_block_learned_search,
+            ROCKSDB_NAMESPACE::BlockBasedTableOptions()
+                .index_block_learned_search,
+            "BlockBasedTableOptions::index_block_learned_search");
+
 DEFINE_string(db, "", "Use the db with the following name.");
 
 DEFINE_string(secondaries_base, "",
@@ -1184,6 +1184,108 @@ TEST_P(PrefetchTest, DBIterLevelReadAheadWithAsyncIO) {
   Close();
 }
 
+TEST_P(PrefetchTest, DBIterPrefetchNextFileWithAsyncIO) {
+  const int kNumKeys = 1000;
+  std::shared_ptr<MockFS> fs =
+      std::make_shared<MockFS>(env_->GetFileSystem(), true);
+  std::unique_ptr<Env> env(new CompositeEnvWrapper(env_, fs));
+
+  bool use_direct_io = std::get<0>(GetParam());
+
+  Options options;
+  SetGenericOptions(env.get(), use_direct_io, options);
+  options.statistics = CreateDBStatistics();
+  BlockBasedTableOptions table_options;
+  SetBlockBasedTableOptions(table_options);
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+
+  Status s = TryReopen(options);
+  if (use_direct_io && (s.IsNotSupported() || s.IsInvalidArgument())) {
+    // If direct IO is not supported, skip the test
+    return;
+  } else {
+    ASSERT_OK(s);
+  }
+
+  Random rnd(309);
+  int total_keys = 0;
+  for (int j = 0; j < 5; j++) {
+    WriteBatch batch;
+    for (int i = j * kNumKeys; i < (j + 1) * kNumKeys; i++) {
+      ASSERT_OK(batch.Put(Key(i), rnd.RandomString(1000)));
+      total_keys++;
+    }
+    ASSERT_OK(db_->Write(WriteOptions(), &batch));
+    ASSERT_OK(Flush());
+  }
+  MoveFilesToLevel(2);
+  const int num_sst_files = NumTableFilesAtLevel(2);
+  ASSERT_GE(num_sst_files, 3);
+
+  int prefetch_next_file_count = 0;
+  SyncPoint::GetInstance()->SetCallBack(
+      "LevelIterator::PrefetchNextFile",
+      [&](void*) { prefetch_next_file_count++; });
+  SyncPoint::GetInstance()->EnableProcessing();
+
+  for (bool async_io : {false, true}) {
+    ReadOptions ro;
+    ro.async_io = async_io;
+    ro.adaptive_readahead = std::get<1>(GetParam());
+
+    prefetch_next_file_count = 0;
+    ASSERT_OK(options.statistics->Reset());
+
+    auto iter = std::unique_ptr<Iterator>(db_->NewIterator(ro));
+    int num_keys = 0;
+    for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+      ASSERT_OK(iter->status());
+      num_keys++;
+    }
+    ASSERT_OK(iter->status());
+    ASSERT_EQ(num_keys, total_keys);
+
+    const uint64_t hits = options.statistics->getAndResetTickerCount(
+        LEVEL_ITER_NEXT_FILE_PREFETCH_HIT);
+    const uint64_t misses = options.statistics->getAndResetTickerCount(
+        LEVEL_ITER_NEXT_FILE_PREFETCH_MISS);
+    if (async_io) {
+      // The first boundary crossing only starts prefetching, every later file
+      // has been hinted by the time the scan gets to it.
+      ASSERT_EQ(misses, 1U);
+      ASSERT_EQ(hits, static_cast<uint64_t>(num_sst_files - 2));
+      ASSERT_EQ(prefetch_next_file_count, num_sst_files - 2);
+    } else {
+      ASSERT_EQ(misses, 0U);
+      ASSERT_EQ(hits, 0U);
+      ASSERT_EQ(prefetch_next_file_count, 0);
+    }
+  }
+
+  // A scan bounded within the second file does not hint the files after it.
+  {
+    ReadOptions ro;
+    ro.async_io = true;
+    std::string upper_bound = Key(kNumKeys + kNumKeys / 2);
+    Slice ub = upper_bound;
+    ro.iterate_upper_bound = &ub;
+
+    prefetch_next_file_count = 0;
+    auto iter = std::unique_ptr<Iterator>(db_->NewIterator(ro));
+    int num_keys = 0;
+    for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+      num_keys++;
+    }
+    ASSERT_OK(iter->status());
+    ASSERT_EQ(num_keys, kNumKeys + kNumKeys / 2);
+    ASSERT_EQ(prefetch_next_file_count, 0);
+  }
+
+  SyncPoint::GetInstance()->DisableProcessing();
+  SyncPoint::GetInstance()->ClearAllCallBacks();
+  Close();
+}
+
 TEST_P(PrefetchTest, DBIterAsyncIONoIOUring) {
   if (mem_env_ || encrypted_env_) {
     ROCKSDB_GTEST_SKIP("Test requires non-mem or non-encrypted environment");
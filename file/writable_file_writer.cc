@@ -20,6 +20,7 @@
 #include "rocksdb/system_clock.h"
 #include "test_util/sync_point.h"
 #include "util/crc32c.h"
+#include "util/file_checksum_helper.h"
 #include "util/random.h"
 #include "util/rate_limiter.h"
 
@@ -56,7 +57,7 @@ IOStatus WritableFileWriter::Append(const Slice& data, uint32_t crc32c_checksum,
   TEST_KILL_RANDOM_WITH_WEIGHT("WritableFileWriter::Append:0", REDUCE_ODDS2);
 
   // Calculate the checksum of appended data
-  UpdateFileChecksum(data);
+  UpdateFileChecksum(data, crc32c_checksum);
 
   {
     IOOptions io_options;
@@ -728,8 +729,22 @@ IOStatus WritableFileWriter::WriteBufferedWithChecksum(
   return s;
 }
 
-void WritableFileWriter::UpdateFileChecksum(const Slice& data) {
-  if (checksum_generator_ != nullptr) {
+void WritableFileWriter::InitCrc32cChecksumGenerator(
+    FileChecksumGenFactory* factory) {
+  // The built-in factory only creates FileChecksumGenCrc32c
+  if (checksum_generator_ != nullptr &&
+      factory == GetFileChecksumGenCrc32cFactory().get()) {
+    crc32c_checksum_generator_ =
+        static_cast<FileChecksumGenCrc32c*>(checksum_generator_.get());
+  }
+}
+
+void WritableFileWriter::UpdateFileChecksum(const Slice& data,
+                                            uint32_t crc32c_checksum) {
+  if (crc32c_checksum_generator_ != nullptr && crc32c_checksum != 0) {
+    assert(crc32c_checksum == crc32c::Value(data.data(), data.size()));
+    crc32c_checksum_generator_->UpdateWithCrc32c(crc32c_checksum, data.size());
+  } else if (checksum_generator_ != nullptr) {
     checksum_generator_->Update(data.data(), data.size());
   }
 }
@@ -23,6 +23,7 @@
 #include "util/aligned_buffer.h"
 
 namespace ROCKSDB_NAMESPACE {
+class FileChecksumGenCrc32c;
 class Statistics;
 class SystemClock;
 
@@ -129,7 +130,8 @@ class WritableFileWriter {
   }
 
   bool ShouldNotifyListeners() const { return !listeners_.empty(); }
-  void UpdateFileChecksum(const Slice& data);
+  void InitCrc32cChecksumGenerator(FileChecksumGenFactory* factory);
+  void UpdateFileChecksum(const Slice& data, uint32_t crc32c_checksum);
   void Crc32cHandoffChecksumCalculation(const char* data, size_t size,
                                         char* buf);
 
@@ -161,6 +163,9 @@ class WritableFileWriter {
   Statistics* stats_;
   std::vector<std::shared_ptr<EventListener>> listeners_;
   std::unique_ptr<FileChecksumGenerator> checksum_generator_;
+  // Set when checksum_generator_ is the built-in crc32c generator, which can
+  // take the crc32c checksums passed to Append() instead of the data.
+  FileChecksumGenCrc32c* crc32c_checksum_generator_;
   bool checksum_finalized_;
   bool perform_data_verification_;
   uint32_t buffered_data_crc32c_checksum_;
@@ -193,6 +198,7 @@ class WritableFileWriter {
         stats_(stats),
         listeners_(),
         checksum_generator_(nullptr),
+        crc32c_checksum_generator_(nullptr),
         checksum_finalized_(false),
         perform_data_verification_(perform_data_verification),
         buffered_data_crc32c_checksum_(0),
@@ -215,6 +221,7 @@ class WritableFileWriter {
       checksum_generator_ =
           file_checksum_gen_factory->CreateFileChecksumGenerator(
               checksum_gen_context);
+      InitCrc32cChecksumGenerator(file_checksum_gen_factory);
     }
   }
 
@@ -234,7 +241,9 @@ class WritableFileWriter {
   std::string file_name() const { return file_name_; }
 
   // When this Append API is called, if the crc32c_checksum is not provided, we
-  // will calculate the checksum internally.
+  // will calculate the checksum internally. A provided crc32c_checksum is also
+  // used to update the file checksum when it is generated with the built-in
+  // crc32c generator.
   IOStatus Append(const Slice& data, uint32_t crc32c_checksum = 0,
                   Env::IOPriority op_rate_limiter_priority = Env::IO_TOTAL);
 
@@ -277,6 +286,7 @@ class WritableFileWriter {
   void TEST_SetFileChecksumGenerator(
       FileChecksumGenerator* checksum_generator) {
     checksum_generator_.reset(checksum_generator);
+    crc32c_checksum_generator_ = nullptr;
   }
 
   std::string GetFileChecksum();
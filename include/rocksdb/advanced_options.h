@@ -438,6 +438,24 @@ struct AdvancedColumnFamilyOptions {
   // Dynamically changeable through SetOptions() API
   bool memtable_whole_key_filtering = false;
 
+  // EXPERIMENTAL
+  // Enables a hash index in memtable from each user key to its newest entry.
+  // Point lookups (Get and MultiGet) use it to skip the memtable rep for keys
+  // that are not in the memtable, and to read the newest version of a key
+  // without searching the rep when it is visible to the lookup and is not a
+  // merge operand. Other lookups fall back to the rep. The index takes
+  // write_buffer_size * memtable_hash_index_size_ratio bytes of buckets, plus
+  // a node per distinct key in the memtable. It is only used with comparators
+  // for which keys are equal only if their bytes are, such as the built-in
+  // ones, and not with user-defined timestamps.
+  //
+  // If this value is larger than 0.25, it is sanitized to 0.25.
+  //
+  // Default: 0 (disabled)
+  //
+  // Dynamically changeable through SetOptions() API
+  double memtable_hash_index_size_ratio = 0.0;
+
   // Page size for huge page for the arena used by the memtable. If <=0, it
   // won't allocate from huge page but from malloc.
   // Users are responsible to reserve huge pages for it to be allocated. For
@@ -731,6 +749,29 @@ struct AdvancedColumnFamilyOptions {
   // Dynamically changeable through SetOptions() API
   uint64_t hard_pending_compaction_bytes_limit = 256 * 1073741824ull;
 
+  // EXPERIMENTAL
+  // Starts slowing down writes before they reach a write slowdown trigger,
+  // once the column family is this fraction of the way to one. The progress
+  // towards a trigger is measured from level0_file_num_compaction_trigger to
+  // level0_slowdown_writes_trigger for L0 files, from 0 to
+  // soft_pending_compaction_bytes_limit for pending compaction bytes, and from
+  // min_write_buffer_number_to_merge to the number of memtables that delays
+  // writes. Its last change is added to it, so that growing debt is throttled
+  // earlier than steady debt.
+  //
+  // The delayed write rate goes down linearly from delayed_write_rate at this
+  // ratio to half of it at the trigger, where the regular write slowdown takes
+  // over from that rate. Writes are thus slowed down gradually rather than all
+  // at once when a trigger is hit, which gives flushes and compactions the
+  // time to catch up before writes get stopped.
+  //
+  // Values of 0 or at least 1 disable it.
+  //
+  // Default: 0 (disabled)
+  //
+  // Dynamically changeable through SetOptions() API
+  double write_throttle_start_ratio = 0.0;
+
   // The compaction style. Default: kCompactionStyleLevel
   CompactionStyle compaction_style = kCompactionStyleLevel;
 
@@ -846,6 +887,19 @@ struct AdvancedColumnFamilyOptions {
   // Default: true
   bool force_consistency_checks = true;
 
+  // EXPERIMENTAL
+  // If greater than 1, a flush may split the key range of the memtables it
+  // flushes into up to this many partitions and build a level-0 file for each
+  // partition on its own thread. The files do not overlap and are installed
+  // together. Partitions hold at least 1MB of memtable data each, so small
+  // flushes still build a single file. Flushes that include range deletions
+  // or user-defined timestamps, flushes with blob files enabled, memtable
+  // representations other than the skip list and B+-tree, and atomic flush
+  // always build a single file.
+  //
+  // Default: 1
+  uint32_t max_flush_partitions = 1;
+
   // Measure IO stats in compactions and flushes, if true.
   //
   // Default: false
@@ -123,6 +123,8 @@ typedef struct rocksdb_sstfilewriter_t rocksdb_sstfilewriter_t;
 typedef struct rocksdb_ratelimiter_t rocksdb_ratelimiter_t;
 typedef struct rocksdb_perfcontext_t rocksdb_perfcontext_t;
 typedef struct rocksdb_pinnableslice_t rocksdb_pinnableslice_t;
+typedef struct rocksdb_pinnableslices_t rocksdb_pinnableslices_t;
+typedef struct rocksdb_pinnableentities_t rocksdb_pinnableentities_t;
 typedef struct rocksdb_transactiondb_options_t rocksdb_transactiondb_options_t;
 typedef struct rocksdb_transactiondb_t rocksdb_transactiondb_t;
 typedef struct rocksdb_transaction_options_t rocksdb_transaction_options_t;
@@ -556,6 +558,30 @@ extern ROCKSDB_LIBRARY_API void rocksdb_batched_multi_get_cf(
     const char* const* keys_list, const size_t* keys_list_sizes,
     rocksdb_pinnableslice_t** values, char** errs, const bool sorted_input);
 
+// Like rocksdb_batched_multi_get_cf, but all values are returned in a single
+// rocksdb_pinnableslices_t. Values are pinned in the block cache (or other
+// storage of the DB) where possible instead of being copied, and stay valid
+// until the returned object is passed to rocksdb_pinnableslices_destroy().
+// rocksdb_pinnableslices_value() returns NULL for keys that were not found
+// or had an error.
+extern ROCKSDB_LIBRARY_API rocksdb_pinnableslices_t*
+rocksdb_batched_multi_get_pinned_cf(
+    rocksdb_t* db, const rocksdb_readoptions_t* options,
+    rocksdb_column_family_handle_t* column_family, size_t num_keys,
+    const char* const* keys_list, const size_t* keys_list_sizes, char** errs,
+    const bool sorted_input);
+
+// Batched MultiGetEntity. Entities (or plain values, as a single anonymous
+// column) are pinned like in rocksdb_batched_multi_get_pinned_cf and stay
+// valid until rocksdb_pinnableentities_destroy(). Keys that were not found
+// or had an error have no columns.
+extern ROCKSDB_LIBRARY_API rocksdb_pinnableentities_t*
+rocksdb_batched_multi_get_entity_cf(
+    rocksdb_t* db, const rocksdb_readoptions_t* options,
+    rocksdb_column_family_handle_t* column_family, size_t num_keys,
+    const char* const* keys_list, const size_t* keys_list_sizes, char** errs,
+    const bool sorted_input);
+
 // The value is only allocated (using malloc) and returned if it is found and
 // value_found isn't NULL. In that case the user is responsible for freeing it.
 extern ROCKSDB_LIBRARY_API unsigned char rocksdb_key_may_exist(
@@ -2815,6 +2841,22 @@ extern ROCKSDB_LIBRARY_API void rocksdb_pinnableslice_destroy(
 extern ROCKSDB_LIBRARY_API const char* rocksdb_pinnableslice_value(
     const rocksdb_pinnableslice_t* t, size_t* vlen);
 
+extern ROCKSDB_LIBRARY_API void rocksdb_pinnableslices_destroy(
+    rocksdb_pinnableslices_t* v);
+extern ROCKSDB_LIBRARY_API const char* rocksdb_pinnableslices_value(
+    const rocksdb_pinnableslices_t* v, size_t index, size_t* vlen);
+
+extern ROCKSDB_LIBRARY_API void rocksdb_pinnableentities_destroy(
+    rocksdb_pinnableentities_t* v);
+extern ROCKSDB_LIBRARY_API size_t rocksdb_pinnableentities_num_columns(
+    const rocksdb_pinnableentities_t* v, size_t index);
+extern ROCKSDB_LIBRARY_API const char* rocksdb_pinnableentities_column_name(
+    const rocksdb_pinnableentities_t* v, size_t index, size_t column,
+    size_t* name_len);
+extern ROCKSDB_LIBRARY_API const char* rocksdb_pinnableentities_column_value(
+    const rocksdb_pinnableentities_t* v, size_t index, size_t column,
+    size_t* value_len);
+
 extern ROCKSDB_LIBRARY_API rocksdb_memory_consumers_t*
 rocksdb_memory_consumers_create(void);
 extern ROCKSDB_LIBRARY_API void rocksdb_memory_consumers_add_db(
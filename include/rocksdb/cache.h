@@ -333,8 +333,23 @@ struct HyperClockCacheOptions : public ShardedCacheOptions {
   // GetOccupancyCount(). However, when the average value size might vary
   // (e.g. balance between metadata and data blocks in cache), it is better
   // to estimate toward the lower side than the higher side.
+  //
+  // EXPERIMENTAL If 0, no estimate is needed: each shard's table starts small
+  // and grows (without locking) as its occupancy rises, up to the size a
+  // fixed table would have for an average entry charge of 512 bytes. Table
+  // slots are only charged to the cache (kFullChargeCacheMetadata) as the
+  // table grows. This is a good choice when the mix of entry sizes is
+  // unknown or changes over time.
   size_t estimated_entry_charge;
 
+  // EXPERIMENTAL If true and RocksDB is built with NUMA support, the hash
+  // table of each cache shard is allocated on a NUMA node chosen round-robin
+  // by shard index, rather than wherever the thread creating the cache happens
+  // to run. On multi-socket hosts this spreads the cache metadata traffic
+  // over all memory controllers. No effect without NUMA support, or with
+  // estimated_entry_charge = 0.
+  bool numa_aware = false;
+
   HyperClockCacheOptions(
       size_t _capacity, size_t _estimated_entry_charge,
       int _num_shard_bits = -1, bool _strict_capacity_limit = false,
@@ -965,6 +965,15 @@ class DB {
     // available in the map form.
     static const std::string kDBWriteStallStats;
 
+    //  "rocksdb.db-write-stage-stats" - returns a multi-line string or map
+    //      with the latency in microseconds of each stage of the write path,
+    //      taken from the histograms of `DBOptions::statistics`. Not available
+    //      without statistics. Map keys are "<stage>.<stat>", where stage is
+    //      one of "join_group", "form_group", "wal", "wal_sync", "memtable",
+    //      "callback" and "delay", and stat is one of "count", "average",
+    //      "p50", "p99" and "max".
+    static const std::string kDBWriteStageStats;
+
     //  "rocksdb.dbstats" - As a string property, returns a multi-line string
     //      with general database stats, both cumulative (over the db's
     //      lifetime) and interval (since the last retrieval of kDBStats).
@@ -18,7 +18,9 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "rocksdb/cleanable.h"
 #include "rocksdb/slice.h"
@@ -27,6 +29,46 @@
 
 namespace ROCKSDB_NAMESPACE {
 
+// EXPERIMENTAL
+// A batch of consecutive key-value pairs filled by Iterator::NextBatch().
+// Entries either point into data pinned by the iterator or into buffers owned
+// by the batch; see Iterator::NextBatch() for the lifetime rules.
+class KeyValueBatch {
+ public:
+  KeyValueBatch() {}
+  // No copying allowed
+  KeyValueBatch(const KeyValueBatch&) = delete;
+  void operator=(const KeyValueBatch&) = delete;
+
+  size_t size() const { return keys_.size(); }
+  bool empty() const { return keys_.empty(); }
+
+  const std::vector<Slice>& keys() const { return keys_; }
+  const std::vector<Slice>& values() const { return values_; }
+
+  // Removes all entries. The most recently allocated buffer is kept for reuse.
+  void Clear();
+
+  // Appends an entry. `key` and `value` are copied into buffers owned by the
+  // batch unless the corresponding `*_pinned` flag is set, in which case the
+  // caller guarantees that the data outlives the batch's use.
+  void Append(const Slice& key, bool key_pinned, const Slice& value,
+              bool value_pinned);
+
+ private:
+  Slice Copy(const Slice& data);
+
+  static constexpr size_t kBufferSize = 4096;
+
+  std::vector<Slice> keys_;
+  std::vector<Slice> values_;
+  // Buffers are never reallocated, so copied entries stay valid while more
+  // entries are appended.
+  std::vector<std::unique_ptr<char[]>> buffers_;
+  size_t buffer_size_ = 0;
+  size_t buffer_used_ = 0;
+};
+
 class Iterator : public Cleanable {
  public:
   Iterator() {}
@@ -107,6 +149,20 @@ class Iterator : public Cleanable {
   // satisfied without doing some IO, then this returns Status::Incomplete().
   virtual Status status() const = 0;
 
+  // EXPERIMENTAL
+  // Clears `batch`, then appends up to `max_entries` consecutive entries to it
+  // starting with the current one, and leaves the iterator positioned on the
+  // entry following the last one appended (or !Valid() if there is none).
+  // This is equivalent to calling key(), value() and Next() in a loop, but
+  // lets implementations save per-entry virtual calls and copies. Keys and
+  // values point into data pinned by the iterator when possible (see
+  // ReadOptions::pin_data) and into buffers owned by `batch` otherwise; either
+  // way they stay valid until `batch` is cleared or destroyed, but never
+  // longer than the iterator itself. Does nothing but clear `batch` if
+  // !Valid().
+  // Returns status().
+  virtual Status NextBatch(size_t max_entries, KeyValueBatch* batch);
+
   // If supported, renew the iterator to represent the latest state. The
   // iterator will be invalidated after the call. Not supported if
   // ReadOptions.snapshot is given when creating the iterator.
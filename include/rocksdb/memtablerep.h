@@ -386,6 +386,31 @@ class VectorRepFactory : public MemTableRepFactory {
                                          Logger* logger) override;
 };
 
+// This creates MemTableReps that are backed by a B+-tree with cache-line
+// sized nodes and optimistic lock coupling. Compared to the skip list, point
+// lookups and seeks touch fewer cache lines once the memtable holds many
+// entries, and concurrent inserts into different leaves do not contend.
+class BTreeRepFactory : public MemTableRepFactory {
+ public:
+  BTreeRepFactory() {}
+
+  // Methods for Configurable/Customizable class overrides
+  static const char* kClassName() { return "BTreeRepFactory"; }
+  static const char* kNickName() { return "btree"; }
+  const char* Name() const override { return kClassName(); }
+  const char* NickName() const override { return kNickName(); }
+
+  // Methods for MemTableRepFactory class overrides
+  using MemTableRepFactory::CreateMemTableRep;
+  MemTableRep* CreateMemTableRep(const MemTableRep::KeyComparator&, Allocator*,
+                                 const SliceTransform*,
+                                 Logger* logger) override;
+
+  bool IsInsertConcurrentlySupported() const override { return true; }
+
+  bool CanHandleDuplicatedKey() const override { return true; }
+};
+
 // This class contains a fixed array of buckets, each
 // pointing to a skiplist (null if the bucket is empty).
 // bucket_count: number of fixed array buckets
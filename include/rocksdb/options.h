@@ -1110,6 +1110,28 @@ struct DBOptions {
   // Default: 1 MB
   uint64_t max_write_batch_group_size_bytes = 1 << 20;
 
+  // EXPERIMENTAL
+  // If true, write group leaders size their groups from moving estimates of
+  // how long a write group takes to be written and how fast new writers
+  // arrive, rather than only from the leader's write size. When writers
+  // arrive faster than groups are written, a group may take in about as many
+  // writers as arrive while one group is written, up to
+  // max_write_batch_group_size_bytes. When groups are written quickly, the
+  // group stays small to keep the latency of the leader's write low.
+  //
+  // Default: false
+  bool adaptive_write_group_size = false;
+
+  // EXPERIMENTAL
+  // With adaptive_write_group_size, the leader of a sync write group may wait
+  // up to this many microseconds for the writers it expects to arrive before
+  // it writes and syncs the WAL, so that they share the sync instead of
+  // waiting for another one. A leader only waits when writers are expected to
+  // arrive within the limit. 0 means leaders never wait.
+  //
+  // Default: 0
+  uint64_t write_group_max_wait_usec = 0;
+
   // The maximum number of microseconds that a write operation will use
   // a yielding spin loop to coordinate with other write threads before
   // blocking on a mutex.  (Assuming write_thread_slow_yield_usec is
@@ -1228,6 +1250,15 @@ struct DBOptions {
   // versions regardless of the wal_compression settings.
   CompressionType wal_compression = kNoCompression;
 
+  // EXPERIMENTAL
+  // If nonzero and wal_compression is enabled, the compressor of each new WAL
+  // is primed with up to this many bytes (capped at 16KB) of the most recent
+  // record data of the previous WAL, so that small records can reference
+  // content seen before. The dictionary is stored in the WAL's header record.
+  // WALs written with a dictionary cannot be read by versions that do not
+  // support this option.
+  size_t wal_compression_max_dict_bytes = 0;
+
   // If true, RocksDB supports flushing multiple column families and committing
   // their results atomically to MANIFEST. Note that it is not
   // necessary to set atomic_flush to true if WAL is always enabled since WAL
@@ -1696,6 +1727,34 @@ struct ReadOptions {
   // Default: true
   bool optimize_multiget_for_io;
 
+  // Experimental
+  //
+  // If non-null, wide-column reads (the columns returned by GetEntity,
+  // MultiGetEntity, and Iterator::columns()) only include the columns whose
+  // names appear in the pointed-to vector, and the remaining columns are
+  // dropped before the result is materialized. Plain key-values are treated
+  // as an entity with only the default column. Iterator::value() and Get()
+  // are not affected. The names must be sorted in bytewise order with no
+  // duplicates, and the vector must outlive any iterator created with these
+  // options.
+  //
+  // Default: nullptr
+  const std::vector<Slice>* column_projection;
+
+  // Experimental
+  //
+  // Maximum number of threads, including the calling thread, that a single
+  // MultiGet or MultiGetEntity call may use. When greater than 1 and the call
+  // has more keys per column family than one internal batch (32 keys), the
+  // batches are looked up concurrently on a reader thread pool owned by the
+  // DB, which is grown to (multiget_parallelism - 1) threads on demand.
+  // Results are the same as for a sequential MultiGet. Not used with
+  // value_size_soft_limit or in transactions, and PerfContext/IOStatsContext
+  // of the calling thread do not include work done by the pool threads.
+  //
+  // Default: 1
+  size_t multiget_parallelism;
+
   ReadOptions();
   ReadOptions(bool cksum, bool cache);
 };
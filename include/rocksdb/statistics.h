@@ -429,6 +429,12 @@ enum Tickers : uint32_t {
   // that finds its data for table open
   TABLE_OPEN_PREFETCH_TAIL_HIT,
 
+  // Number of times a forward scan with ReadOptions::async_io moved into the
+  // next file of a level after / before that file's first data blocks had
+  // been prefetched
+  LEVEL_ITER_NEXT_FILE_PREFETCH_HIT,
+  LEVEL_ITER_NEXT_FILE_PREFETCH_MISS,
+
   TICKER_ENUM_MAX
 };
 
@@ -546,6 +552,25 @@ enum Histograms : uint32_t {
   // system's prefetch) from the end of SST table during block based table open
   TABLE_OPEN_PREFETCH_TAIL_READ_BYTES,
 
+  // Number of writers in each write group, including the leader
+  WRITE_GROUP_SIZE,
+
+  // Latency of the stages of a write, recorded for a sample of the writes.
+  // WAL syncs are also reported alone in WAL_FILE_SYNC_MICROS, and write
+  // delays in WRITE_STALL.
+  // Time a writer waits to lead a write group or have its write done by
+  // another leader
+  WRITE_JOIN_GROUP_MICROS,
+  // Time a leader takes to form its write group
+  WRITE_FORM_GROUP_MICROS,
+  // Time a write group takes to be written to the WAL, including syncing it
+  WRITE_WAL_MICROS,
+  // Time a write group, or a writer in a parallel group, takes to be inserted
+  // into the memtables
+  WRITE_MEMTABLE_MICROS,
+  // Time each PreReleaseCallback and PostMemTableCallback of a write takes
+  WRITE_CALLBACK_MICROS,
+
   HISTOGRAM_ENUM_MAX
 };
 
@@ -245,6 +245,37 @@ struct BlockBasedTableOptions {
   // kDataBlockBinaryAndHash.
   double data_block_hash_table_util_ratio = 0.75;
 
+  // If true, every data block loaded into memory gets a small array holding
+  // the first 8 bytes of each restart key's user key as a big-endian integer
+  // (8 bytes per restart point). Seeks into the block first narrow the
+  // restart-point binary search on this contiguous array and only decode
+  // restart keys and call the comparator on prefix ties. This saves several
+  // key decodings and comparator calls per seek, most noticeably for large
+  // blocks with many restart points.
+  //
+  // The on-disk format is unchanged. Only takes effect when the column
+  // family uses BytewiseComparator() (without user-defined timestamps).
+  //
+  // Default: false
+  bool data_block_restart_key_prefixes = false;
+
+  // If true, every index block (including index partitions and the top level
+  // of a partitioned index) loaded into memory gets the same kind of restart
+  // key prefix array as `data_block_restart_key_prefixes`, plus a small
+  // piecewise linear ("learned") model mapping a key prefix to its
+  // approximate position in the index. Index seeks then predict the position
+  // and only search a bounded window of the prefix array around it, instead
+  // of doing log2(N) dependent cache misses across the whole index block. The
+  // model is skipped for small blocks and for key distributions it cannot fit
+  // compactly; correctness never depends on the model's accuracy.
+  //
+  // Works best for fixed-length or numeric (big-endian encoded) keys. The
+  // on-disk format is unchanged. Only takes effect when the column family
+  // uses BytewiseComparator() (without user-defined timestamps).
+  //
+  // Default: false
+  bool index_block_learned_search = false;
+
   // Option hash_index_allow_collision is now deleted.
   // It will behave as if hash_index_allow_collision=true.
 
@@ -195,9 +195,15 @@ class WriteBatch : public WriteBatchBase {
   Status PutLogData(const Slice& blob) override;
 
   using WriteBatchBase::Clear;
-  // Clear all updates buffered in this batch.
+  // Clear all updates buffered in this batch. Memory already allocated for
+  // the batch is kept, so a cleared batch can be refilled without
+  // reallocating.
   void Clear() override;
 
+  // Makes sure the batch can grow to `bytes` of serialized data without
+  // reallocating. Never releases memory.
+  void Reserve(size_t bytes);
+
   // Records the state of the batch for future calls to RollbackToSavePoint().
   // May be called multiple times to set multiple save points.
   void SetSavePoint() override;
@@ -5129,6 +5129,10 @@ class TickerTypeJni {
         return -0x3A;
       case ROCKSDB_NAMESPACE::Tickers::TABLE_OPEN_PREFETCH_TAIL_HIT:
         return -0x3B;
+      case ROCKSDB_NAMESPACE::Tickers::LEVEL_ITER_NEXT_FILE_PREFETCH_HIT:
+        return -0x3C;
+      case ROCKSDB_NAMESPACE::Tickers::LEVEL_ITER_NEXT_FILE_PREFETCH_MISS:
+        return -0x3D;
       case ROCKSDB_NAMESPACE::Tickers::TICKER_ENUM_MAX:
         // 0x5F was the max value in the initial copy of tickers to Java.
         // Since these values are exposed directly to Java clients, we keep
@@ -5490,6 +5494,10 @@ class TickerTypeJni {
         return ROCKSDB_NAMESPACE::Tickers::TABLE_OPEN_PREFETCH_TAIL_MISS;
       case -0x3B:
         return ROCKSDB_NAMESPACE::Tickers::TABLE_OPEN_PREFETCH_TAIL_HIT;
+      case -0x3C:
+        return ROCKSDB_NAMESPACE::Tickers::LEVEL_ITER_NEXT_FILE_PREFETCH_HIT;
+      case -0x3D:
+        return ROCKSDB_NAMESPACE::Tickers::LEVEL_ITER_NEXT_FILE_PREFETCH_MISS;
       case 0x5F:
         // 0x5F was the max value in the initial copy of tickers to Java.
         // Since these values are exposed directly to Java clients, we keep
@@ -5619,6 +5627,18 @@ class HistogramTypeJni {
         return 0x38;
       case ROCKSDB_NAMESPACE::Histograms::TABLE_OPEN_PREFETCH_TAIL_READ_BYTES:
         return 0x39;
+      case ROCKSDB_NAMESPACE::Histograms::WRITE_GROUP_SIZE:
+        return 0x3A;
+      case ROCKSDB_NAMESPACE::Histograms::WRITE_JOIN_GROUP_MICROS:
+        return 0x3B;
+      case ROCKSDB_NAMESPACE::Histograms::WRITE_FORM_GROUP_MICROS:
+        return 0x3C;
+      case ROCKSDB_NAMESPACE::Histograms::WRITE_WAL_MICROS:
+        return 0x3D;
+      case ROCKSDB_NAMESPACE::Histograms::WRITE_MEMTABLE_MICROS:
+        return 0x3E;
+      case ROCKSDB_NAMESPACE::Histograms::WRITE_CALLBACK_MICROS:
+        return 0x3F;
       case ROCKSDB_NAMESPACE::Histograms::HISTOGRAM_ENUM_MAX:
         // 0x1F for backwards compatibility on current minor version.
         return 0x1F;
@@ -5738,6 +5758,18 @@ class HistogramTypeJni {
       case 0x39:
         return ROCKSDB_NAMESPACE::Histograms::
             TABLE_OPEN_PREFETCH_TAIL_READ_BYTES;
+      case 0x3A:
+        return ROCKSDB_NAMESPACE::Histograms::WRITE_GROUP_SIZE;
+      case 0x3B:
+        return ROCKSDB_NAMESPACE::Histograms::WRITE_JOIN_GROUP_MICROS;
+      case 0x3C:
+        return ROCKSDB_NAMESPACE::Histograms::WRITE_FORM_GROUP_MICROS;
+      case 0x3D:
+        return ROCKSDB_NAMESPACE::Histograms::WRITE_WAL_MICROS;
+      case 0x3E:
+        return ROCKSDB_NAMESPACE::Histograms::WRITE_MEMTABLE_MICROS;
+      case 0x3F:
+        return ROCKSDB_NAMESPACE::Histograms::WRITE_CALLBACK_MICROS;
       case 0x1F:
         // 0x1F for backwards compatibility on current minor version.
         return ROCKSDB_NAMESPACE::Histograms::HISTOGRAM_ENUM_MAX;
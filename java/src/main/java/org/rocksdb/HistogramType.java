@@ -169,6 +169,39 @@ public enum HistogramType {
    */
   TABLE_OPEN_PREFETCH_TAIL_READ_BYTES((byte) 0x39),
 
+  /**
+   * Number of writers in each write group, including the leader.
+   */
+  WRITE_GROUP_SIZE((byte) 0x3A),
+
+  /**
+   * Time a writer waits in the write queue until it leads a write group or
+   * its write is done by others.
+   */
+  WRITE_JOIN_GROUP_MICROS((byte) 0x3B),
+
+  /**
+   * Time a leader takes to form its write group.
+   */
+  WRITE_FORM_GROUP_MICROS((byte) 0x3C),
+
+  /**
+   * Time a write group takes to be written to the WAL, including the WAL
+   * sync of sync writes.
+   */
+  WRITE_WAL_MICROS((byte) 0x3D),
+
+  /**
+   * Time a write group, or a writer in a parallel group, takes to be
+   * inserted into the memtables.
+   */
+  WRITE_MEMTABLE_MICROS((byte) 0x3E),
+
+  /**
+   * Time each PreReleaseCallback and PostMemTableCallback of a write takes.
+   */
+  WRITE_CALLBACK_MICROS((byte) 0x3F),
+
   // 0x1F for backwards compatibility on current minor version.
   HISTOGRAM_ENUM_MAX((byte) 0x1F);
 
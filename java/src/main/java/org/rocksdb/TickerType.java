@@ -754,6 +754,18 @@ public enum TickerType {
      */
     TABLE_OPEN_PREFETCH_TAIL_HIT((byte) -0x3B),
 
+    /**
+     * Number of times a forward scan with async_io moved into the next file
+     * of a level after that file's first data blocks had been prefetched.
+     */
+    LEVEL_ITER_NEXT_FILE_PREFETCH_HIT((byte) -0x3C),
+
+    /**
+     * Number of times a forward scan with async_io moved into the next file
+     * of a level without that file's first data blocks having been prefetched.
+     */
+    LEVEL_ITER_NEXT_FILE_PREFETCH_MISS((byte) -0x3D),
+
     TICKER_ENUM_MAX((byte) 0x5F);
 
     private final byte value;
@@ -0,0 +1,611 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+//
+// ConcurrentBTree is an insert-only B+-tree of pointers to encoded keys,
+// used as an alternative to InlineSkipList for memtables. Nodes are a few
+// cache lines wide, so a lookup takes one cache miss per level of a shallow
+// tree rather than one per level of a tall skip list, and leaves hold runs of
+// consecutive keys for iteration.
+//
+// Thread safety
+// -------------
+// Writes may be concurrent with each other and with reads. Synchronization
+// uses optimistic lock coupling: every node has a version word whose low bit
+// is a write lock. Readers never write to shared memory; they record a node's
+// version before reading it and validate it afterwards, restarting from the
+// root if a writer got in the way. Writers additionally lock the nodes they
+// modify (at most a node and its parent). Since nothing is ever removed, a
+// node is never freed or retired and the tree only changes by inserting into
+// a node or splitting it.
+//
+// Nodes and keys are allocated from the provided Allocator and must remain
+// allocated for the lifetime of the tree (as with an arena).
+
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "memory/allocator.h"
+#include "port/likely.h"
+#include "port/port.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+template <class Comparator>
+class ConcurrentBTree {
+ private:
+  struct Node;
+  struct Leaf;
+  struct Inner;
+
+  // Nodes are sized to kNodeSize bytes, so inner nodes and leaves both start
+  // and end on cache line boundaries.
+  static constexpr size_t kNodeSize = 4 * CACHE_LINE_SIZE;
+  static constexpr size_t kHeaderSize = 16;
+  static constexpr uint32_t kLeafCapacity = static_cast<uint32_t>(
+      (kNodeSize - kHeaderSize - sizeof(void*)) / sizeof(void*));
+  static constexpr uint32_t kInnerCapacity = static_cast<uint32_t>(
+      (kNodeSize - kHeaderSize - sizeof(void*)) / (2 * sizeof(void*)));
+
+ public:
+  // Create a new ConcurrentBTree object that will use "cmp" for comparing
+  // keys, and will allocate memory using "*allocator". Objects allocated in
+  // the allocator must remain allocated for the lifetime of the tree object.
+  explicit ConcurrentBTree(Comparator cmp, Allocator* allocator);
+  // No copying allowed
+  ConcurrentBTree(const ConcurrentBTree&) = delete;
+  ConcurrentBTree& operator=(const ConcurrentBTree&) = delete;
+
+  // Inserts the encoded key. Returns false, without inserting, if a key
+  // comparing equal is already present.
+  // REQUIRES: key points to memory that stays valid and unchanged for the
+  // lifetime of the tree.
+  bool Insert(const char* key);
+
+  // Returns true iff an entry that compares equal to key is in the tree.
+  bool Contains(const char* key) const;
+
+  // Iteration over the contents of the tree. An iterator works on a copy of
+  // one leaf at a time, so keys inserted while it is positioned on a leaf
+  // might not be seen, but iteration always stays in order.
+  class Iterator {
+   public:
+    // Initialize an iterator over the specified tree.
+    // The returned iterator is not valid.
+    explicit Iterator(const ConcurrentBTree* tree);
+
+    // Returns true iff the iterator is positioned at a valid node.
+    bool Valid() const { return pos_ < count_; }
+
+    // Returns the key at the current position.
+    // REQUIRES: Valid()
+    const char* key() const {
+      assert(Valid());
+      return keys_[pos_];
+    }
+
+    // Advances to the next position.
+    // REQUIRES: Valid()
+    void Next();
+
+    // Advances to the previous position.
+    // REQUIRES: Valid()
+    void Prev();
+
+    // Advance to the first entry with a key >= target
+    void Seek(const char* target);
+
+    // Retreat to the last entry with a key <= target
+    void SeekForPrev(const char* target);
+
+    // Position at the first entry in the tree.
+    // Final state of iterator is Valid() iff the tree is not empty.
+    void SeekToFirst();
+
+    // Position at the last entry in the tree.
+    // Final state of iterator is Valid() iff the tree is not empty.
+    void SeekToLast();
+
+   private:
+    void Invalidate() { pos_ = count_ = 0; }
+
+    const ConcurrentBTree* tree_;
+    // Copy of the keys of the current leaf
+    uint32_t count_ = 0;
+    uint32_t pos_ = 0;
+    const Leaf* next_ = nullptr;
+    const char* keys_[kLeafCapacity];
+  };
+
+ private:
+  // Which way to descend from an inner node
+  enum class Descend {
+    // Into the child that would hold the key
+    kToKey,
+    // Into the child holding the last key less than the key
+    kBeforeKey,
+    kLeftmost,
+    kRightmost,
+  };
+
+  struct Node {
+    // Low bit set while write-locked; incremented by each lock and unlock
+    std::atomic<uint64_t> version;
+    // Number of keys, published with release after the keys themselves
+    std::atomic<uint32_t> count;
+    // 0 for leaves
+    const uint32_t level;
+
+    explicit Node(uint32_t _level) : version(0), count(0), level(_level) {}
+  };
+  static_assert(sizeof(Node) == kHeaderSize, "");
+
+  struct Leaf : public Node {
+    // Right sibling, if any
+    std::atomic<Leaf*> next;
+    std::atomic<const char*> keys[kLeafCapacity];
+
+    Leaf() : Node(0), next(nullptr) {}
+  };
+  static_assert(sizeof(Leaf) <= kNodeSize, "");
+
+  struct Inner : public Node {
+    // children[i] holds keys k with keys[i - 1] <= k < keys[i]
+    std::atomic<const char*> keys[kInnerCapacity];
+    std::atomic<Node*> children[kInnerCapacity + 1];
+
+    explicit Inner(uint32_t _level) : Node(_level) {}
+  };
+  static_assert(sizeof(Inner) <= kNodeSize, "");
+
+  static bool ReadLock(const Node* node, uint64_t* version) {
+    *version = node->version.load(std::memory_order_acquire);
+    if (UNLIKELY(*version & 1)) {
+      port::AsmVolatilePause();
+      return false;
+    }
+    return true;
+  }
+
+  // Whether nothing changed in the node since ReadLock() returned version
+  static bool Validate(const Node* node, uint64_t version) {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return node->version.load(std::memory_order_relaxed) == version;
+  }
+
+  static bool UpgradeToWriteLock(Node* node, uint64_t version) {
+    if (node->version.compare_exchange_strong(version, version + 1,
+                                              std::memory_order_acquire)) {
+      return true;
+    }
+    port::AsmVolatilePause();
+    return false;
+  }
+
+  static void WriteUnlock(Node* node) {
+    node->version.fetch_add(1, std::memory_order_release);
+  }
+
+  void* AllocateNode() {
+    // Over-allocate so that the node can start on a cache line
+    char* mem = allocator_->AllocateAligned(kNodeSize + CACHE_LINE_SIZE - 1);
+    uintptr_t addr = reinterpret_cast<uintptr_t>(mem);
+    addr = (addr + CACHE_LINE_SIZE - 1) & ~uintptr_t{CACHE_LINE_SIZE - 1};
+    return reinterpret_cast<void*>(addr);
+  }
+
+  // Index of the first key in keys[0, count) that is >= key (or > key
+  // if upper), which may be count.
+  template <bool upper>
+  uint32_t Search(const std::atomic<const char*>* keys, uint32_t count,
+                  const char* key) const {
+    uint32_t lo = 0;
+    uint32_t hi = count;
+    while (lo < hi) {
+      uint32_t mid = (lo + hi) / 2;
+      int c = compare_(keys[mid].load(std::memory_order_relaxed), key);
+      if (upper ? c <= 0 : c < 0) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  // Same as Search</*upper=*/false>, over keys copied out of a leaf
+  uint32_t LowerBound(const char* const* keys, uint32_t count,
+                      const char* key) const {
+    uint32_t lo = 0;
+    uint32_t hi = count;
+    while (lo < hi) {
+      uint32_t mid = (lo + hi) / 2;
+      if (compare_(keys[mid], key) < 0) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  uint32_t ChildIndex(const Inner* inner, uint32_t count, const char* key,
+                      Descend descend) const {
+    switch (descend) {
+      case Descend::kToKey:
+        return Search</*upper=*/true>(inner->keys, count, key);
+      case Descend::kBeforeKey:
+        return Search</*upper=*/false>(inner->keys, count, key);
+      case Descend::kLeftmost:
+        return 0;
+      case Descend::kRightmost:
+        return count;
+    }
+    return 0;
+  }
+
+  // Finds the leaf to look for key in, and copies its keys to *keys and
+  // *count and its right sibling to *next, as of a single consistent
+  // version of the leaf.
+  void FindLeaf(const char* key, Descend descend, const char** keys,
+                uint32_t* count, const Leaf** next) const;
+
+  // Copies the keys and right sibling of leaf, as of a single consistent
+  // version of it.
+  static void ReadLeaf(const Leaf* leaf, const char** keys, uint32_t* count,
+                       const Leaf** next);
+
+  // Moves the upper half of node into a new node and returns the new node and
+  // the key separating the two. REQUIRES: node and its parent (if any) are
+  // write-locked.
+  Leaf* SplitLeaf(Leaf* leaf, const char** separator);
+  Inner* SplitInner(Inner* inner, const char** separator);
+
+  // Makes right and its separator a child of parent (or of a new root if
+  // left is the root). REQUIRES: parent (if any) and left are write-locked.
+  void InsertChild(Inner* parent, Node* left, const char* separator,
+                   Node* right);
+
+  Comparator const compare_;
+  Allocator* const allocator_;
+  std::atomic<Node*> root_;
+};
+
+template <class Comparator>
+ConcurrentBTree<Comparator>::ConcurrentBTree(const Comparator cmp,
+                                             Allocator* allocator)
+    : compare_(cmp), allocator_(allocator) {
+  root_.store(new (AllocateNode()) Leaf(), std::memory_order_relaxed);
+}
+
+template <class Comparator>
+void ConcurrentBTree<Comparator>::ReadLeaf(const Leaf* leaf, const char** keys,
+                                           uint32_t* count,
+                                           const Leaf** next) {
+  for (;;) {
+    uint64_t version;
+    if (!ReadLock(leaf, &version)) {
+      continue;
+    }
+    uint32_t n = leaf->count.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < n; ++i) {
+      keys[i] = leaf->keys[i].load(std::memory_order_relaxed);
+    }
+    const Leaf* sibling = leaf->next.load(std::memory_order_relaxed);
+    if (Validate(leaf, version)) {
+      *count = n;
+      *next = sibling;
+      return;
+    }
+  }
+}
+
+template <class Comparator>
+void ConcurrentBTree<Comparator>::FindLeaf(const char* key, Descend descend,
+                                           const char** keys, uint32_t* count,
+                                           const Leaf** next) const {
+restart:
+  const Node* node = root_.load(std::memory_order_acquire);
+  uint64_t version;
+  if (!ReadLock(node, &version) ||
+      node != root_.load(std::memory_order_acquire)) {
+    goto restart;
+  }
+  while (node->level > 0) {
+    const Inner* inner = static_cast<const Inner*>(node);
+    uint32_t n = inner->count.load(std::memory_order_acquire);
+    const Node* child =
+        inner->children[ChildIndex(inner, n, key, descend)].load(
+            std::memory_order_relaxed);
+    if (!Validate(inner, version)) {
+      goto restart;
+    }
+    uint64_t child_version;
+    if (!ReadLock(child, &child_version) || !Validate(inner, version)) {
+      goto restart;
+    }
+    node = child;
+    version = child_version;
+  }
+
+  const Leaf* leaf = static_cast<const Leaf*>(node);
+  uint32_t n = leaf->count.load(std::memory_order_acquire);
+  for (uint32_t i = 0; i < n; ++i) {
+    keys[i] = leaf->keys[i].load(std::memory_order_relaxed);
+  }
+  const Leaf* sibling = leaf->next.load(std::memory_order_relaxed);
+  if (!Validate(leaf, version)) {
+    goto restart;
+  }
+  *count = n;
+  *next = sibling;
+}
+
+template <class Comparator>
+typename ConcurrentBTree<Comparator>::Leaf*
+ConcurrentBTree<Comparator>::SplitLeaf(Leaf* leaf, const char** separator) {
+  Leaf* right = new (AllocateNode()) Leaf();
+  uint32_t n = leaf->count.load(std::memory_order_relaxed);
+  uint32_t keep = n / 2;
+  for (uint32_t i = keep; i < n; ++i) {
+    right->keys[i - keep].store(leaf->keys[i].load(std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+  }
+  right->count.store(n - keep, std::memory_order_relaxed);
+  right->next.store(leaf->next.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+  *separator = right->keys[0].load(std::memory_order_relaxed);
+  // Publish the new leaf before shrinking the old one
+  leaf->next.store(right, std::memory_order_release);
+  leaf->count.store(keep, std::memory_order_release);
+  return right;
+}
+
+template <class Comparator>
+typename ConcurrentBTree<Comparator>::Inner*
+ConcurrentBTree<Comparator>::SplitInner(Inner* inner, const char** separator) {
+  Inner* right = new (AllocateNode()) Inner(inner->level);
+  uint32_t n = inner->count.load(std::memory_order_relaxed);
+  uint32_t keep = n / 2;
+  // keys[keep] moves up to the parent
+  *separator = inner->keys[keep].load(std::memory_order_relaxed);
+  for (uint32_t i = keep + 1; i < n; ++i) {
+    right->keys[i - keep - 1].store(
+        inner->keys[i].load(std::memory_order_relaxed),
+        std::memory_order_relaxed);
+  }
+  for (uint32_t i = keep + 1; i <= n; ++i) {
+    right->children[i - keep - 1].store(
+        inner->children[i].load(std::memory_order_relaxed),
+        std::memory_order_relaxed);
+  }
+  right->count.store(n - keep - 1, std::memory_order_relaxed);
+  inner->count.store(keep, std::memory_order_release);
+  return right;
+}
+
+template <class Comparator>
+void ConcurrentBTree<Comparator>::InsertChild(Inner* parent, Node* left,
+                                              const char* separator,
+                                              Node* right) {
+  if (parent == nullptr) {
+    assert(root_.load(std::memory_order_relaxed) == left);
+    Inner* root = new (AllocateNode()) Inner(left->level + 1);
+    root->keys[0].store(separator, std::memory_order_relaxed);
+    root->children[0].store(left, std::memory_order_relaxed);
+    root->children[1].store(right, std::memory_order_relaxed);
+    root->count.store(1, std::memory_order_relaxed);
+    root_.store(root, std::memory_order_release);
+    return;
+  }
+  uint32_t n = parent->count.load(std::memory_order_relaxed);
+  assert(n < kInnerCapacity);
+  uint32_t pos = Search</*upper=*/true>(parent->keys, n, separator);
+  assert(parent->children[pos].load(std::memory_order_relaxed) == left);
+  // Shift from the end, so that every slot below the published count always
+  // holds some valid pointer
+  parent->children[n + 1].store(
+      parent->children[n].load(std::memory_order_relaxed),
+      std::memory_order_relaxed);
+  for (uint32_t i = n; i > pos; --i) {
+    parent->keys[i].store(parent->keys[i - 1].load(std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+    parent->children[i].store(
+        parent->children[i - 1].load(std::memory_order_relaxed),
+        std::memory_order_relaxed);
+  }
+  parent->keys[pos].store(separator, std::memory_order_relaxed);
+  parent->children[pos + 1].store(right, std::memory_order_relaxed);
+  parent->count.store(n + 1, std::memory_order_release);
+}
+
+template <class Comparator>
+bool ConcurrentBTree<Comparator>::Insert(const char* key) {
+restart:
+  Node* node = root_.load(std::memory_order_acquire);
+  uint64_t version;
+  if (!ReadLock(node, &version) ||
+      node != root_.load(std::memory_order_acquire)) {
+    goto restart;
+  }
+  Inner* parent = nullptr;
+  uint64_t parent_version = 0;
+
+  for (;;) {
+    uint32_t n = node->count.load(std::memory_order_acquire);
+    bool full = node->level > 0 ? n == kInnerCapacity : n == kLeafCapacity;
+    if (full) {
+      // Split eagerly on the way down, so that the parent always has room
+      // for the new separator.
+      if (parent != nullptr && !UpgradeToWriteLock(parent, parent_version)) {
+        goto restart;
+      }
+      if (!UpgradeToWriteLock(node, version)) {
+        if (parent != nullptr) {
+          WriteUnlock(parent);
+        }
+        goto restart;
+      }
+      if (parent == nullptr && node != root_.load(std::memory_order_acquire)) {
+        // Became an inner node of a new root meanwhile
+        WriteUnlock(node);
+        goto restart;
+      }
+      const char* separator;
+      Node* right;
+      if (node->level > 0) {
+        right = SplitInner(static_cast<Inner*>(node), &separator);
+      } else {
+        right = SplitLeaf(static_cast<Leaf*>(node), &separator);
+      }
+      InsertChild(parent, node, separator, right);
+      WriteUnlock(node);
+      if (parent != nullptr) {
+        WriteUnlock(parent);
+      }
+      goto restart;
+    }
+
+    if (node->level == 0) {
+      break;
+    }
+    if (parent != nullptr && !Validate(parent, parent_version)) {
+      goto restart;
+    }
+    Inner* inner = static_cast<Inner*>(node);
+    Node* child =
+        inner->children[Search</*upper=*/true>(inner->keys, n, key)].load(
+            std::memory_order_relaxed);
+    if (!Validate(inner, version)) {
+      goto restart;
+    }
+    uint64_t child_version;
+    if (!ReadLock(child, &child_version)) {
+      goto restart;
+    }
+    parent = inner;
+    parent_version = version;
+    node = child;
+    version = child_version;
+  }
+
+  Leaf* leaf = static_cast<Leaf*>(node);
+  if (!UpgradeToWriteLock(leaf, version)) {
+    goto restart;
+  }
+  if (parent != nullptr && !Validate(parent, parent_version)) {
+    // The leaf might no longer cover key
+    WriteUnlock(leaf);
+    goto restart;
+  }
+  uint32_t n = leaf->count.load(std::memory_order_relaxed);
+  uint32_t pos = Search</*upper=*/false>(leaf->keys, n, key);
+  if (pos < n &&
+      compare_(leaf->keys[pos].load(std::memory_order_relaxed), key) == 0) {
+    WriteUnlock(leaf);
+    return false;
+  }
+  for (uint32_t i = n; i > pos; --i) {
+    leaf->keys[i].store(leaf->keys[i - 1].load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+  }
+  leaf->keys[pos].store(key, std::memory_order_relaxed);
+  leaf->count.store(n + 1, std::memory_order_release);
+  WriteUnlock(leaf);
+  return true;
+}
+
+template <class Comparator>
+bool ConcurrentBTree<Comparator>::Contains(const char* key) const {
+  Iterator iter(this);
+  iter.Seek(key);
+  return iter.Valid() && compare_(iter.key(), key) == 0;
+}
+
+template <class Comparator>
+ConcurrentBTree<Comparator>::Iterator::Iterator(const ConcurrentBTree* tree)
+    : tree_(tree) {}
+
+template <class Comparator>
+void ConcurrentBTree<Comparator>::Iterator::Next() {
+  assert(Valid());
+  ++pos_;
+  if (pos_ == count_) {
+    if (next_ == nullptr) {
+      Invalidate();
+      return;
+    }
+    // Everything in the right sibling is greater than every key copied from
+    // this leaf, even if either leaf was split since.
+    ReadLeaf(next_, keys_, &count_, &next_);
+    pos_ = 0;
+    // Leaves other than the root are never empty
+    assert(count_ > 0);
+  }
+}
+
+template <class Comparator>
+void ConcurrentBTree<Comparator>::Iterator::Prev() {
+  assert(Valid());
+  if (pos_ > 0) {
+    --pos_;
+    return;
+  }
+  // Leaves have no left sibling links, so search for the last key before
+  // the current one.
+  const char* target = keys_[0];
+  tree_->FindLeaf(target, Descend::kBeforeKey, keys_, &count_, &next_);
+  uint32_t n = tree_->LowerBound(keys_, count_, target);
+  if (n == 0) {
+    Invalidate();
+  } else {
+    pos_ = n - 1;
+  }
+}
+
+template <class Comparator>
+void ConcurrentBTree<Comparator>::Iterator::Seek(const char* target) {
+  tree_->FindLeaf(target, Descend::kToKey, keys_, &count_, &next_);
+  pos_ = tree_->LowerBound(keys_, count_, target);
+  if (pos_ == count_) {
+    if (next_ == nullptr) {
+      Invalidate();
+      return;
+    }
+    // Keys in the right sibling are all greater than target
+    ReadLeaf(next_, keys_, &count_, &next_);
+    pos_ = 0;
+  }
+}
+
+template <class Comparator>
+void ConcurrentBTree<Comparator>::Iterator::SeekForPrev(const char* target) {
+  Seek(target);
+  if (!Valid()) {
+    SeekToLast();
+  }
+  while (Valid() && tree_->compare_(target, key()) < 0) {
+    Prev();
+  }
+}
+
+template <class Comparator>
+void ConcurrentBTree<Comparator>::Iterator::SeekToFirst() {
+  tree_->FindLeaf(nullptr, Descend::kLeftmost, keys_, &count_, &next_);
+  pos_ = 0;
+}
+
+template <class Comparator>
+void ConcurrentBTree<Comparator>::Iterator::SeekToLast() {
+  tree_->FindLeaf(nullptr, Descend::kRightmost, keys_, &count_, &next_);
+  if (count_ > 0) {
+    pos_ = count_ - 1;
+  }
+}
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -0,0 +1,221 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "memtable/concurrent_btree.h"
+
+#include <atomic>
+#include <set>
+#include <vector>
+
+#include "memory/concurrent_arena.h"
+#include "port/port.h"
+#include "test_util/testharness.h"
+#include "util/random.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// Our test tree stores 8-byte unsigned integers
+using Key = uint64_t;
+
+static const char* Encode(const uint64_t* key) {
+  return reinterpret_cast<const char*>(key);
+}
+
+static Key Decode(const char* key) {
+  Key rv;
+  memcpy(&rv, key, sizeof(Key));
+  return rv;
+}
+
+struct TestComparator {
+  int operator()(const char* a, const char* b) const {
+    if (Decode(a) < Decode(b)) {
+      return -1;
+    } else if (Decode(a) > Decode(b)) {
+      return +1;
+    } else {
+      return 0;
+    }
+  }
+};
+
+using TestBTree = ConcurrentBTree<TestComparator>;
+
+class ConcurrentBTreeTest : public testing::Test {
+ public:
+  ConcurrentBTreeTest() : tree_(TestComparator(), &arena_) {}
+
+  bool Insert(Key key) {
+    char* buf = arena_.AllocateAligned(sizeof(Key));
+    memcpy(buf, &key, sizeof(Key));
+    return tree_.Insert(buf);
+  }
+
+  // Checks that the tree holds exactly the keys of the model
+  void Validate(const std::set<Key>& model) {
+    for (Key key : model) {
+      ASSERT_TRUE(tree_.Contains(Encode(&key)));
+    }
+    TestBTree::Iterator iter(&tree_);
+    ASSERT_FALSE(iter.Valid());
+    iter.SeekToFirst();
+    for (Key key : model) {
+      ASSERT_TRUE(iter.Valid());
+      ASSERT_EQ(key, Decode(iter.key()));
+      iter.Next();
+    }
+    ASSERT_FALSE(iter.Valid());
+    iter.SeekToLast();
+    for (auto it = model.rbegin(); it != model.rend(); ++it) {
+      ASSERT_TRUE(iter.Valid());
+      ASSERT_EQ(*it, Decode(iter.key()));
+      iter.Prev();
+    }
+    ASSERT_FALSE(iter.Valid());
+  }
+
+ protected:
+  ConcurrentArena arena_;
+  TestBTree tree_;
+};
+
+TEST_F(ConcurrentBTreeTest, Empty) {
+  Key key = 10;
+  ASSERT_FALSE(tree_.Contains(Encode(&key)));
+
+  TestBTree::Iterator iter(&tree_);
+  ASSERT_FALSE(iter.Valid());
+  iter.SeekToFirst();
+  ASSERT_FALSE(iter.Valid());
+  iter.SeekToLast();
+  ASSERT_FALSE(iter.Valid());
+  iter.Seek(Encode(&key));
+  ASSERT_FALSE(iter.Valid());
+  iter.SeekForPrev(Encode(&key));
+  ASSERT_FALSE(iter.Valid());
+}
+
+TEST_F(ConcurrentBTreeTest, InsertAndLookup) {
+  const int N = 20000;
+  const int R = 50000;
+  Random rnd(1000);
+  std::set<Key> keys;
+  for (int i = 0; i < N; i++) {
+    Key key = rnd.Next() % R;
+    ASSERT_EQ(keys.insert(key).second, Insert(key));
+  }
+
+  for (Key i = 0; i < R; i++) {
+    ASSERT_EQ(keys.count(i) == 1, tree_.Contains(Encode(&i)));
+  }
+
+  // Forward and backward iteration from targets across the key range
+  for (Key i = 0; i < R; i += 7) {
+    TestBTree::Iterator iter(&tree_);
+    iter.Seek(Encode(&i));
+    auto model_iter = keys.lower_bound(i);
+    for (int j = 0; j < 40; j++) {
+      if (model_iter == keys.end()) {
+        ASSERT_FALSE(iter.Valid());
+        break;
+      }
+      ASSERT_TRUE(iter.Valid());
+      ASSERT_EQ(*model_iter, Decode(iter.key()));
+      ++model_iter;
+      iter.Next();
+    }
+
+    iter.SeekForPrev(Encode(&i));
+    model_iter = keys.upper_bound(i);
+    for (int j = 0; j < 40; j++) {
+      if (model_iter == keys.begin()) {
+        ASSERT_FALSE(iter.Valid());
+        break;
+      }
+      ASSERT_TRUE(iter.Valid());
+      ASSERT_EQ(*--model_iter, Decode(iter.key()));
+      iter.Prev();
+    }
+  }
+
+  Validate(keys);
+}
+
+TEST_F(ConcurrentBTreeTest, SequentialInsert) {
+  // Ascending and descending runs always split the same edge of the tree
+  std::set<Key> keys;
+  for (Key i = 0; i < 10000; i++) {
+    ASSERT_TRUE(Insert(2 * i + 20001));
+    ASSERT_TRUE(Insert(20000 - 2 * i));
+    keys.insert(2 * i + 20001);
+    keys.insert(20000 - 2 * i);
+  }
+  Validate(keys);
+}
+
+TEST_F(ConcurrentBTreeTest, ConcurrentInsertAndRead) {
+  const int kWriters = 4;
+  const Key kKeysPerWriter = 20000;
+  std::atomic<int> writers_done{0};
+  std::atomic<bool> reader_ok{true};
+
+  // Readers must always see the keys in order, and never fewer keys than
+  // they saw before.
+  port::Thread reader([&]() {
+    size_t last_count = 0;
+    while (writers_done.load() < kWriters) {
+      TestBTree::Iterator iter(&tree_);
+      size_t count = 0;
+      Key prev = 0;
+      for (iter.SeekToFirst(); iter.Valid(); iter.Next()) {
+        Key key = Decode(iter.key());
+        if (count > 0 && key <= prev) {
+          reader_ok = false;
+        }
+        prev = key;
+        count++;
+      }
+      if (count < last_count) {
+        reader_ok = false;
+      }
+      last_count = count;
+    }
+  });
+
+  std::vector<port::Thread> writers;
+  for (int t = 0; t < kWriters; t++) {
+    writers.emplace_back([&, t]() {
+      // Interleave the writers' keys so they contend for the same leaves,
+      // and have every writer also try to insert the others' keys.
+      Random rnd(301 + t);
+      for (Key i = 0; i < kKeysPerWriter; i++) {
+        Key key = i * kWriters + t;
+        Insert(key);
+        Key other = i * kWriters + rnd.Uniform(kWriters);
+        Insert(other);
+      }
+      writers_done.fetch_add(1);
+    });
+  }
+  for (auto& w : writers) {
+    w.join();
+  }
+  reader.join();
+  ASSERT_TRUE(reader_ok.load());
+
+  std::set<Key> keys;
+  for (Key i = 0; i < kWriters * kKeysPerWriter; i++) {
+    keys.insert(i);
+  }
+  Validate(keys);
+}
+
+}  // namespace ROCKSDB_NAMESPACE
+
+int main(int argc, char** argv) {
+  ROCKSDB_NAMESPACE::port::InstallStackTraceHandler();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,128 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+
+#include "db/dbformat.h"
+#include "memory/allocator.h"
+#include "rocksdb/slice.h"
+#include "util/coding.h"
+#include "util/hash.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// A hash index from user key to the newest entry of that key in a memtable,
+// kept next to the memtable rep so that point lookups can go straight to the
+// newest version of a key, and skip the rep entirely for keys that are not
+// in the memtable.
+//
+// Entries are the encoded memtable entries handed out by the rep, starting
+// with the length-prefixed internal key. The index only stores pointers to
+// them, so it relies on the entries living as long as the memtable.
+//
+// Insert() may be called concurrently with itself and with Find(). Nodes are
+// allocated from `allocator`, which must then support concurrent allocation,
+// and are never freed before the allocator.
+class MemTableHashIndex {
+ public:
+  MemTableHashIndex(size_t num_buckets, Allocator* allocator)
+      : num_buckets_(num_buckets > 0 ? num_buckets : 1),
+        allocator_(allocator) {
+    char* mem = allocator_->AllocateAligned(sizeof(std::atomic<Node*>) *
+                                            num_buckets_);
+    buckets_ = reinterpret_cast<std::atomic<Node*>*>(mem);
+    for (size_t i = 0; i < num_buckets_; i++) {
+      new (&buckets_[i]) std::atomic<Node*>(nullptr);
+    }
+  }
+
+  // No copying allowed
+  MemTableHashIndex(const MemTableHashIndex&) = delete;
+  MemTableHashIndex& operator=(const MemTableHashIndex&) = delete;
+
+  // Records `entry` as the newest entry of its user key, unless the index
+  // already holds a newer one.
+  void Insert(const char* entry) {
+    Slice user_key = ExtractUserKey(GetLengthPrefixedSlice(entry));
+    const SequenceNumber seq = EntrySequence(entry);
+    std::atomic<Node*>& bucket = buckets_[BucketIndex(user_key)];
+    Node* new_node = nullptr;
+    Node* head = bucket.load(std::memory_order_acquire);
+    while (true) {
+      for (Node* node = head; node != nullptr;
+           node = node->next.load(std::memory_order_acquire)) {
+        const char* current = node->entry.load(std::memory_order_acquire);
+        if (ExtractUserKey(GetLengthPrefixedSlice(current)) != user_key) {
+          continue;
+        }
+        while (EntrySequence(current) < seq &&
+               !node->entry.compare_exchange_weak(current, entry,
+                                                  std::memory_order_release,
+                                                  std::memory_order_acquire)) {
+        }
+        // Nodes allocated for an insert that lost a race stay in the
+        // allocator until the memtable is freed.
+        return;
+      }
+      if (new_node == nullptr) {
+        char* mem = allocator_->AllocateAligned(sizeof(Node));
+        new_node = new (mem) Node(entry);
+      }
+      new_node->next.store(head, std::memory_order_relaxed);
+      if (bucket.compare_exchange_strong(head, new_node,
+                                         std::memory_order_release,
+                                         std::memory_order_acquire)) {
+        return;
+      }
+      // Another key was added to the bucket. `head` was reloaded, so look
+      // again in case it was the same key.
+    }
+  }
+
+  // Returns the newest entry of `user_key`, or nullptr if the memtable has
+  // none.
+  const char* Find(const Slice& user_key) const {
+    for (Node* node =
+             buckets_[BucketIndex(user_key)].load(std::memory_order_acquire);
+         node != nullptr; node = node->next.load(std::memory_order_acquire)) {
+      const char* entry = node->entry.load(std::memory_order_acquire);
+      if (ExtractUserKey(GetLengthPrefixedSlice(entry)) == user_key) {
+        return entry;
+      }
+    }
+    return nullptr;
+  }
+
+  // Sequence number of a memtable entry
+  static SequenceNumber EntrySequence(const char* entry) {
+    return GetInternalKeySeqno(GetLengthPrefixedSlice(entry));
+  }
+
+  // Value type of a memtable entry
+  static ValueType EntryType(const char* entry) {
+    return ExtractValueType(GetLengthPrefixedSlice(entry));
+  }
+
+ private:
+  struct Node {
+    explicit Node(const char* _entry) : entry(_entry), next(nullptr) {}
+
+    std::atomic<const char*> entry;
+    std::atomic<Node*> next;
+  };
+
+  size_t BucketIndex(const Slice& user_key) const {
+    return static_cast<size_t>(GetSliceNPHash64(user_key) % num_buckets_);
+  }
+
+  const size_t num_buckets_;
+  Allocator* const allocator_;
+  std::atomic<Node*>* buckets_;
+};
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -25,6 +25,7 @@ int main() {
 #include "db/dbformat.h"
 #include "db/memtable.h"
 #include "memory/arena.h"
+#include "memory/concurrent_arena.h"
 #include "port/port.h"
 #include "port/stack_trace.h"
 #include "rocksdb/comparator.h"
@@ -47,6 +48,8 @@ DEFINE_string(benchmarks, "fillrandom",
               "Comma-separated list of benchmarks to run. Options:\n"
               "\tfillrandom             -- write N random values\n"
               "\tfillseq                -- write N values in sequential order\n"
+              "\tfillrandomconcurrent   -- N threads write N random values "
+              "together\n"
               "\treadrandom             -- read N values in random order\n"
               "\treadseq                -- scan the DB\n"
               "\treadwrite              -- 1 thread writes while N - 1 threads "
@@ -60,6 +63,7 @@ DEFINE_string(memtablerep, "skiplist",
               "include/memtablerep.h for\n"
               "  more details. Options:\n"
               "\tskiplist            -- backed by a skiplist\n"
+              "\tbtree               -- backed by a concurrent B+-tree\n"
               "\tvector              -- backed by an std::vector\n"
               "\thashskiplist        -- backed by a hash skip list\n"
               "\thashlinklist        -- backed by a hash linked list\n"
@@ -99,7 +103,9 @@ DEFINE_int64(write_buffer_size, 256,
 DEFINE_int32(
     num_threads, 1,
     "Number of concurrent threads to run. If the benchmark includes writes,\n"
-    "then at most one thread will be a writer");
+    "then at most one thread will be a writer, except for "
+    "fillrandomconcurrent\n"
+    "where all threads are writers");
 
 DEFINE_int32(num_operations, 1000000,
              "Number of operations to do for write and random read benchmarks");
@@ -286,6 +292,50 @@ class ConcurrentFillBenchmarkThread : public FillBenchmarkThread {
   std::atomic_int* threads_done_;
 };
 
+class ConcurrentInsertBenchmarkThread : public BenchmarkThread {
+ public:
+  ConcurrentInsertBenchmarkThread(MemTableRep* table, KeyGenerator* key_gen,
+                                  uint64_t* bytes_written, uint64_t num_ops,
+                                  uint32_t thread_id, port::Mutex* insert_mutex)
+      : BenchmarkThread(table, key_gen, bytes_written, nullptr, nullptr,
+                        num_ops, nullptr),
+        thread_id_(thread_id),
+        insert_mutex_(insert_mutex) {}
+
+  void operator()() override {
+    auto internal_key_size = 16;
+    auto encoded_len =
+        FLAGS_item_size + VarintLength(internal_key_size) + internal_key_size;
+    for (uint64_t i = 0; i < num_ops_; ++i) {
+      char* buf = nullptr;
+      KeyHandle handle = table_->Allocate(encoded_len, &buf);
+      assert(buf != nullptr);
+      char* p = EncodeVarint32(buf, internal_key_size);
+      // Every thread writes its own keys, so the keys are unique with a
+      // per-thread sequence number.
+      EncodeFixed64(p, key_gen_->Next() * FLAGS_num_threads + thread_id_);
+      p += 8;
+      EncodeFixed64(p, i + 1);
+      p += 8;
+      Slice bytes = generator_.Generate(FLAGS_item_size);
+      memcpy(p, bytes.data(), FLAGS_item_size);
+      if (insert_mutex_ == nullptr) {
+        table_->InsertConcurrently(handle);
+      } else {
+        // The memtable rep does not support concurrent inserts; serialize
+        // them as the write path would.
+        MutexLock l(insert_mutex_);
+        table_->Insert(handle);
+      }
+    }
+    *bytes_written_ = num_ops_ * encoded_len;
+  }
+
+ private:
+  const uint32_t thread_id_;
+  port::Mutex* const insert_mutex_;
+};
+
 class ReadBenchmarkThread : public BenchmarkThread {
  public:
   ReadBenchmarkThread(MemTableRep* table, KeyGenerator* key_gen,
@@ -475,6 +525,45 @@ class FillBenchmark : public Benchmark {
   }
 };
 
+class ConcurrentFillBenchmark : public Benchmark {
+ public:
+  explicit ConcurrentFillBenchmark(MemTableRep* table, Random64* rand,
+                                   bool insert_concurrently)
+      : Benchmark(table, nullptr, nullptr, FLAGS_num_threads),
+        rand_(rand),
+        insert_concurrently_(insert_concurrently) {
+    num_write_ops_per_thread_ = FLAGS_num_operations / FLAGS_num_threads;
+  }
+
+  void RunThreads(std::vector<port::Thread>* threads, uint64_t* bytes_written,
+                  uint64_t* /*bytes_read*/, bool /*write*/,
+                  uint64_t* /*read_hits*/) override {
+    std::vector<std::unique_ptr<KeyGenerator>> key_gens;
+    std::vector<uint64_t> thread_bytes_written(num_threads_);
+    port::Mutex insert_mutex;
+    for (uint32_t i = 0; i < num_threads_; ++i) {
+      key_gens.emplace_back(
+          new KeyGenerator(rand_, UNIQUE_RANDOM, num_write_ops_per_thread_));
+    }
+    for (uint32_t i = 0; i < num_threads_; ++i) {
+      threads->emplace_back(ConcurrentInsertBenchmarkThread(
+          table_, key_gens[i].get(), &thread_bytes_written[i],
+          num_write_ops_per_thread_, i,
+          insert_concurrently_ ? nullptr : &insert_mutex));
+    }
+    for (auto& thread : *threads) {
+      thread.join();
+    }
+    for (uint64_t bytes : thread_bytes_written) {
+      *bytes_written += bytes;
+    }
+  }
+
+ private:
+  Random64* rand_;
+  const bool insert_concurrently_;
+};
+
 class ReadBenchmark : public Benchmark {
  public:
   explicit ReadBenchmark(MemTableRep* table, KeyGenerator* key_gen,
@@ -612,7 +701,7 @@ int main(int argc, char** argv) {
   ROCKSDB_NAMESPACE::InternalKeyComparator internal_key_comp(
       ROCKSDB_NAMESPACE::BytewiseComparator());
   ROCKSDB_NAMESPACE::MemTable::KeyComparator key_comp(internal_key_comp);
-  ROCKSDB_NAMESPACE::Arena arena;
+  ROCKSDB_NAMESPACE::ConcurrentArena arena;
   ROCKSDB_NAMESPACE::WriteBufferManager wb(FLAGS_write_buffer_size);
   uint64_t sequence;
   auto createMemtableRep = [&] {
@@ -648,6 +737,15 @@ int main(int argc, char** argv) {
           &rng, ROCKSDB_NAMESPACE::UNIQUE_RANDOM, FLAGS_num_operations));
       benchmark.reset(new ROCKSDB_NAMESPACE::FillBenchmark(
           memtablerep.get(), key_gen.get(), &sequence));
+    } else if (name == ROCKSDB_NAMESPACE::Slice("fillrandomconcurrent")) {
+      memtablerep.reset(createMemtableRep());
+      if (!factory->IsInsertConcurrentlySupported()) {
+        std::cout << "WARNING: " << FLAGS_memtablerep
+                  << " does not support concurrent inserts, serializing them"
+                  << std::endl;
+      }
+      benchmark.reset(new ROCKSDB_NAMESPACE::ConcurrentFillBenchmark(
+          memtablerep.get(), &rng, factory->IsInsertConcurrentlySupported()));
     } else if (name == ROCKSDB_NAMESPACE::Slice("readrandom")) {
       key_gen.reset(new ROCKSDB_NAMESPACE::KeyGenerator(
           &rng, ROCKSDB_NAMESPACE::RANDOM, FLAGS_num_operations));
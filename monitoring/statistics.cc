@@ -219,6 +219,10 @@ const std::vector<std::pair<Tickers, std::string>> TickersNameMap = {
     {SECONDARY_CACHE_DATA_HITS, "rocksdb.secondary.cache.data.hits"},
     {TABLE_OPEN_PREFETCH_TAIL_MISS, "rocksdb.table.open.prefetch.tail.miss"},
     {TABLE_OPEN_PREFETCH_TAIL_HIT, "rocksdb.table.open.prefetch.tail.hit"},
+    {LEVEL_ITER_NEXT_FILE_PREFETCH_HIT,
+     "rocksdb.level.iter.next.file.prefetch.hit"},
+    {LEVEL_ITER_NEXT_FILE_PREFETCH_MISS,
+     "rocksdb.level.iter.next.file.prefetch.miss"},
 };
 
 const std::vector<std::pair<Histograms, std::string>> HistogramsNameMap = {
@@ -277,6 +281,12 @@ const std::vector<std::pair<Histograms, std::string>> HistogramsNameMap = {
     {ASYNC_PREFETCH_ABORT_MICROS, "rocksdb.async.prefetch.abort.micros"},
     {TABLE_OPEN_PREFETCH_TAIL_READ_BYTES,
      "rocksdb.table.open.prefetch.tail.read.bytes"},
+    {WRITE_GROUP_SIZE, "rocksdb.write.group.size"},
+    {WRITE_JOIN_GROUP_MICROS, "rocksdb.write.join.group.micros"},
+    {WRITE_FORM_GROUP_MICROS, "rocksdb.write.form.group.micros"},
+    {WRITE_WAL_MICROS, "rocksdb.write.wal.micros"},
+    {WRITE_MEMTABLE_MICROS, "rocksdb.write.memtable.micros"},
+    {WRITE_CALLBACK_MICROS, "rocksdb.write.callback.micros"},
 };
 
 std::shared_ptr<Statistics> CreateDBStatistics() {
@@ -260,6 +260,10 @@ static std::unordered_map<std::string, OptionTypeInfo>
                    hard_pending_compaction_bytes_limit),
           OptionType::kUInt64T, OptionVerificationType::kNormal,
           OptionTypeFlags::kMutable}},
+        {"write_throttle_start_ratio",
+         {offsetof(struct MutableCFOptions, write_throttle_start_ratio),
+          OptionType::kDouble, OptionVerificationType::kNormal,
+          OptionTypeFlags::kMutable}},
         {"hard_rate_limit",
          {0, OptionType::kDouble, OptionVerificationType::kDeprecated,
           OptionTypeFlags::kMutable}},
@@ -341,6 +345,10 @@ static std::unordered_map<std::string, OptionTypeInfo>
          {offsetof(struct MutableCFOptions, memtable_whole_key_filtering),
           OptionType::kBoolean, OptionVerificationType::kNormal,
           OptionTypeFlags::kMutable}},
+        {"memtable_hash_index_size_ratio",
+         {offsetof(struct MutableCFOptions, memtable_hash_index_size_ratio),
+          OptionType::kDouble, OptionVerificationType::kNormal,
+          OptionTypeFlags::kMutable}},
         {"min_partial_merge_operands",
          {0, OptionType::kUInt32T, OptionVerificationType::kDeprecated,
           OptionTypeFlags::kMutable}},
@@ -568,6 +576,10 @@ static std::unordered_map<std::string, OptionTypeInfo>
          {offsetof(struct ImmutableCFOptions, force_consistency_checks),
           OptionType::kBoolean, OptionVerificationType::kNormal,
           OptionTypeFlags::kNone}},
+        {"max_flush_partitions",
+         {offsetof(struct ImmutableCFOptions, max_flush_partitions),
+          OptionType::kUInt32T, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
         {"preclude_last_level_data_seconds",
          {offsetof(struct ImmutableCFOptions, preclude_last_level_data_seconds),
           OptionType::kUInt64T, OptionVerificationType::kNormal,
@@ -910,6 +922,7 @@ ImmutableCFOptions::ImmutableCFOptions(const ColumnFamilyOptions& cf_options)
       num_levels(cf_options.num_levels),
       optimize_filters_for_hits(cf_options.optimize_filters_for_hits),
       force_consistency_checks(cf_options.force_consistency_checks),
+      max_flush_partitions(cf_options.max_flush_partitions),
       preclude_last_level_data_seconds(
           cf_options.preclude_last_level_data_seconds),
       preserve_internal_time_seconds(cf_options.preserve_internal_time_seconds),
@@ -1011,6 +1024,8 @@ void MutableCFOptions::Dump(Logger* log) const {
                  memtable_prefix_bloom_size_ratio);
   ROCKS_LOG_INFO(log, "              memtable_whole_key_filtering: %d",
                  memtable_whole_key_filtering);
+  ROCKS_LOG_INFO(log, "            memtable_hash_index_size_ratio: %f",
+                 memtable_hash_index_size_ratio);
   ROCKS_LOG_INFO(log,
                  "                  memtable_huge_page_size: %" ROCKSDB_PRIszt,
                  memtable_huge_page_size);
@@ -1030,6 +1045,8 @@ void MutableCFOptions::Dump(Logger* log) const {
                  soft_pending_compaction_bytes_limit);
   ROCKS_LOG_INFO(log, "      hard_pending_compaction_bytes_limit: %" PRIu64,
                  hard_pending_compaction_bytes_limit);
+  ROCKS_LOG_INFO(log, "               write_throttle_start_ratio: %f",
+                 write_throttle_start_ratio);
   ROCKS_LOG_INFO(log, "       level0_file_num_compaction_trigger: %d",
                  level0_file_num_compaction_trigger);
   ROCKS_LOG_INFO(log, "           level0_slowdown_writes_trigger: %d",
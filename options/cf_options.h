@@ -72,6 +72,8 @@ struct ImmutableCFOptions {
 
   bool force_consistency_checks;
 
+  uint32_t max_flush_partitions;
+
   uint64_t preclude_last_level_data_seconds;
 
   uint64_t preserve_internal_time_seconds;
@@ -114,6 +116,7 @@ struct MutableCFOptions {
         memtable_prefix_bloom_size_ratio(
             options.memtable_prefix_bloom_size_ratio),
         memtable_whole_key_filtering(options.memtable_whole_key_filtering),
+        memtable_hash_index_size_ratio(options.memtable_hash_index_size_ratio),
         memtable_huge_page_size(options.memtable_huge_page_size),
         max_successive_merges(options.max_successive_merges),
         inplace_update_num_locks(options.inplace_update_num_locks),
@@ -125,6 +128,7 @@ struct MutableCFOptions {
             options.soft_pending_compaction_bytes_limit),
         hard_pending_compaction_bytes_limit(
             options.hard_pending_compaction_bytes_limit),
+        write_throttle_start_ratio(options.write_throttle_start_ratio),
         level0_file_num_compaction_trigger(
             options.level0_file_num_compaction_trigger),
         level0_slowdown_writes_trigger(options.level0_slowdown_writes_trigger),
@@ -182,6 +186,7 @@ struct MutableCFOptions {
         arena_block_size(0),
         memtable_prefix_bloom_size_ratio(0),
         memtable_whole_key_filtering(false),
+        memtable_hash_index_size_ratio(0),
         memtable_huge_page_size(0),
         max_successive_merges(0),
         inplace_update_num_locks(0),
@@ -190,6 +195,7 @@ struct MutableCFOptions {
         disable_auto_compactions(false),
         soft_pending_compaction_bytes_limit(0),
         hard_pending_compaction_bytes_limit(0),
+        write_throttle_start_ratio(0),
         level0_file_num_compaction_trigger(0),
         level0_slowdown_writes_trigger(0),
         level0_stop_writes_trigger(0),
@@ -247,6 +253,7 @@ struct MutableCFOptions {
   size_t arena_block_size;
   double memtable_prefix_bloom_size_ratio;
   bool memtable_whole_key_filtering;
+  double memtable_hash_index_size_ratio;
   size_t memtable_huge_page_size;
   size_t max_successive_merges;
   size_t inplace_update_num_locks;
@@ -272,6 +279,7 @@ struct MutableCFOptions {
   bool disable_auto_compactions;
   uint64_t soft_pending_compaction_bytes_limit;
   uint64_t hard_pending_compaction_bytes_limit;
+  double write_throttle_start_ratio;
   int level0_file_num_compaction_trigger;
   int level0_slowdown_writes_trigger;
   int level0_stop_writes_trigger;
@@ -344,6 +344,14 @@ static std::unordered_map<std::string, OptionTypeInfo>
          {offsetof(struct ImmutableDBOptions, max_write_batch_group_size_bytes),
           OptionType::kUInt64T, OptionVerificationType::kNormal,
           OptionTypeFlags::kNone}},
+        {"adaptive_write_group_size",
+         {offsetof(struct ImmutableDBOptions, adaptive_write_group_size),
+          OptionType::kBoolean, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
+        {"write_group_max_wait_usec",
+         {offsetof(struct ImmutableDBOptions, write_group_max_wait_usec),
+          OptionType::kUInt64T, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
         {"write_thread_max_yield_usec",
          {offsetof(struct ImmutableDBOptions, write_thread_max_yield_usec),
           OptionType::kUInt64T, OptionVerificationType::kNormal,
@@ -387,6 +395,10 @@ static std::unordered_map<std::string, OptionTypeInfo>
          {offsetof(struct ImmutableDBOptions, wal_compression),
           OptionType::kCompressionType, OptionVerificationType::kNormal,
           OptionTypeFlags::kNone}},
+        {"wal_compression_max_dict_bytes",
+         {offsetof(struct ImmutableDBOptions, wal_compression_max_dict_bytes),
+          OptionType::kSizeT, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
         {"seq_per_batch",
          {0, OptionType::kBoolean, OptionVerificationType::kDeprecated,
           OptionTypeFlags::kNone}},
@@ -704,6 +716,8 @@ ImmutableDBOptions::ImmutableDBOptions(const DBOptions& options)
       WAL_size_limit_MB(options.WAL_size_limit_MB),
       max_write_batch_group_size_bytes(
           options.max_write_batch_group_size_bytes),
+      adaptive_write_group_size(options.adaptive_write_group_size),
+      write_group_max_wait_usec(options.write_group_max_wait_usec),
       manifest_preallocation_size(options.manifest_preallocation_size),
       allow_mmap_reads(options.allow_mmap_reads),
       allow_mmap_writes(options.allow_mmap_writes),
@@ -741,6 +755,7 @@ ImmutableDBOptions::ImmutableDBOptions(const DBOptions& options)
       two_write_queues(options.two_write_queues),
       manual_wal_flush(options.manual_wal_flush),
       wal_compression(options.wal_compression),
+      wal_compression_max_dict_bytes(options.wal_compression_max_dict_bytes),
       atomic_flush(options.atomic_flush),
       avoid_unnecessary_blocking_io(options.avoid_unnecessary_blocking_io),
       persist_stats_to_disk(options.persist_stats_to_disk),
@@ -834,6 +849,11 @@ void ImmutableDBOptions::Dump(Logger* log) const {
                    "                       "
                    "Options.max_write_batch_group_size_bytes: %" PRIu64,
                    max_write_batch_group_size_bytes);
+  ROCKS_LOG_HEADER(log, "              Options.adaptive_write_group_size: %d",
+                   adaptive_write_group_size);
+  ROCKS_LOG_HEADER(log,
+                   "              Options.write_group_max_wait_usec: %" PRIu64,
+                   write_group_max_wait_usec);
   ROCKS_LOG_HEADER(
       log, "            Options.manifest_preallocation_size: %" ROCKSDB_PRIszt,
       manifest_preallocation_size);
@@ -898,6 +918,9 @@ void ImmutableDBOptions::Dump(Logger* log) const {
                    manual_wal_flush);
   ROCKS_LOG_HEADER(log, "            Options.wal_compression: %d",
                    wal_compression);
+  ROCKS_LOG_HEADER(
+      log, "      Options.wal_compression_max_dict_bytes: %" ROCKSDB_PRIszt,
+      wal_compression_max_dict_bytes);
   ROCKS_LOG_HEADER(log, "            Options.atomic_flush: %d", atomic_flush);
   ROCKS_LOG_HEADER(log,
                    "            Options.avoid_unnecessary_blocking_io: %d",
@@ -54,6 +54,7 @@ AdvancedColumnFamilyOptions::AdvancedColumnFamilyOptions(const Options& options)
       memtable_prefix_bloom_size_ratio(
           options.memtable_prefix_bloom_size_ratio),
       memtable_whole_key_filtering(options.memtable_whole_key_filtering),
+      memtable_hash_index_size_ratio(options.memtable_hash_index_size_ratio),
       memtable_huge_page_size(options.memtable_huge_page_size),
       memtable_insert_with_hint_prefix_extractor(
           options.memtable_insert_with_hint_prefix_extractor),
@@ -77,6 +78,7 @@ AdvancedColumnFamilyOptions::AdvancedColumnFamilyOptions(const Options& options)
           options.soft_pending_compaction_bytes_limit),
       hard_pending_compaction_bytes_limit(
           options.hard_pending_compaction_bytes_limit),
+      write_throttle_start_ratio(options.write_throttle_start_ratio),
       compaction_style(options.compaction_style),
       compaction_pri(options.compaction_pri),
       compaction_options_universal(options.compaction_options_universal),
@@ -90,6 +92,7 @@ AdvancedColumnFamilyOptions::AdvancedColumnFamilyOptions(const Options& options)
       optimize_filters_for_hits(options.optimize_filters_for_hits),
       paranoid_file_checks(options.paranoid_file_checks),
       force_consistency_checks(options.force_consistency_checks),
+      max_flush_partitions(options.max_flush_partitions),
       report_bg_io_stats(options.report_bg_io_stats),
       ttl(options.ttl),
       periodic_compaction_seconds(options.periodic_compaction_seconds),
@@ -295,6 +298,9 @@ void ColumnFamilyOptions::Dump(Logger* log) const {
     ROCKS_LOG_HEADER(log,
                      "  Options.hard_pending_compaction_bytes_limit: %" PRIu64,
                      hard_pending_compaction_bytes_limit);
+    ROCKS_LOG_HEADER(log,
+                     "           Options.write_throttle_start_ratio: %f",
+                     write_throttle_start_ratio);
     ROCKS_LOG_HEADER(log, "               Options.disable_auto_compactions: %d",
                      disable_auto_compactions);
 
@@ -381,6 +387,9 @@ void ColumnFamilyOptions::Dump(Logger* log) const {
     ROCKS_LOG_HEADER(log,
                      "              Options.memtable_whole_key_filtering: %d",
                      memtable_whole_key_filtering);
+    ROCKS_LOG_HEADER(log,
+                     "            Options.memtable_hash_index_size_ratio: %f",
+                     memtable_hash_index_size_ratio);
 
     ROCKS_LOG_HEADER(log, "  Options.memtable_huge_page_size: %" ROCKSDB_PRIszt,
                      memtable_huge_page_size);
@@ -399,6 +408,8 @@ void ColumnFamilyOptions::Dump(Logger* log) const {
                      paranoid_file_checks);
     ROCKS_LOG_HEADER(log, "               Options.force_consistency_checks: %d",
                      force_consistency_checks);
+    ROCKS_LOG_HEADER(log, "                   Options.max_flush_partitions: %u",
+                     max_flush_partitions);
     ROCKS_LOG_HEADER(log, "               Options.report_bg_io_stats: %d",
                      report_bg_io_stats);
     ROCKS_LOG_HEADER(log, "                              Options.ttl: %" PRIu64,
@@ -702,7 +713,9 @@ ReadOptions::ReadOptions()
       value_size_soft_limit(std::numeric_limits<uint64_t>::max()),
       adaptive_readahead(false),
       async_io(false),
-      optimize_multiget_for_io(true) {}
+      optimize_multiget_for_io(true),
+      column_projection(nullptr),
+      multiget_parallelism(1) {}
 
 ReadOptions::ReadOptions(bool cksum, bool cache)
     : snapshot(nullptr),
@@ -728,6 +741,8 @@ ReadOptions::ReadOptions(bool cksum, bool cache)
       value_size_soft_limit(std::numeric_limits<uint64_t>::max()),
       adaptive_readahead(false),
       async_io(false),
-      optimize_multiget_for_io(true) {}
+      optimize_multiget_for_io(true),
+      column_projection(nullptr),
+      multiget_parallelism(1) {}
 
 }  // namespace ROCKSDB_NAMESPACE
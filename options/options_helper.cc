@@ -135,6 +135,10 @@ DBOptions BuildDBOptions(const ImmutableDBOptions& immutable_db_options,
       immutable_db_options.enable_write_thread_adaptive_yield;
   options.max_write_batch_group_size_bytes =
       immutable_db_options.max_write_batch_group_size_bytes;
+  options.adaptive_write_group_size =
+      immutable_db_options.adaptive_write_group_size;
+  options.write_group_max_wait_usec =
+      immutable_db_options.write_group_max_wait_usec;
   options.write_thread_max_yield_usec =
       immutable_db_options.write_thread_max_yield_usec;
   options.write_thread_slow_yield_usec =
@@ -158,6 +162,8 @@ DBOptions BuildDBOptions(const ImmutableDBOptions& immutable_db_options,
   options.two_write_queues = immutable_db_options.two_write_queues;
   options.manual_wal_flush = immutable_db_options.manual_wal_flush;
   options.wal_compression = immutable_db_options.wal_compression;
+  options.wal_compression_max_dict_bytes =
+      immutable_db_options.wal_compression_max_dict_bytes;
   options.atomic_flush = immutable_db_options.atomic_flush;
   options.avoid_unnecessary_blocking_io =
       immutable_db_options.avoid_unnecessary_blocking_io;
@@ -198,6 +204,8 @@ void UpdateColumnFamilyOptions(const MutableCFOptions& moptions,
   cf_opts->memtable_prefix_bloom_size_ratio =
       moptions.memtable_prefix_bloom_size_ratio;
   cf_opts->memtable_whole_key_filtering = moptions.memtable_whole_key_filtering;
+  cf_opts->memtable_hash_index_size_ratio =
+      moptions.memtable_hash_index_size_ratio;
   cf_opts->memtable_huge_page_size = moptions.memtable_huge_page_size;
   cf_opts->max_successive_merges = moptions.max_successive_merges;
   cf_opts->inplace_update_num_locks = moptions.inplace_update_num_locks;
@@ -213,6 +221,7 @@ void UpdateColumnFamilyOptions(const MutableCFOptions& moptions,
       moptions.soft_pending_compaction_bytes_limit;
   cf_opts->hard_pending_compaction_bytes_limit =
       moptions.hard_pending_compaction_bytes_limit;
+  cf_opts->write_throttle_start_ratio = moptions.write_throttle_start_ratio;
   cf_opts->level0_file_num_compaction_trigger =
       moptions.level0_file_num_compaction_trigger;
   cf_opts->level0_slowdown_writes_trigger =
@@ -298,6 +307,7 @@ void UpdateColumnFamilyOptions(const ImmutableCFOptions& ioptions,
   cf_opts->num_levels = ioptions.num_levels;
   cf_opts->optimize_filters_for_hits = ioptions.optimize_filters_for_hits;
   cf_opts->force_consistency_checks = ioptions.force_consistency_checks;
+  cf_opts->max_flush_partitions = ioptions.max_flush_partitions;
   cf_opts->memtable_insert_with_hint_prefix_extractor =
       ioptions.memtable_insert_with_hint_prefix_extractor;
   cf_opts->cf_paths = ioptions.cf_paths;
@@ -185,6 +185,8 @@ TEST_F(OptionsSettableTest, BlockBasedTableOptionsAllFieldsSettable) {
       "data_block_index_type=kDataBlockBinaryAndHash;"
       "index_shortening=kNoShortening;"
       "data_block_hash_table_util_ratio=0.75;"
+      "data_block_restart_key_prefixes=false;"
+      "index_block_learned_search=false;"
       "checksum=kxxHash;no_block_cache=1;"
       "block_cache=1M;block_cache_compressed=1k;block_size=1024;"
       "block_size_deviation=8;block_restart_interval=4; "
@@ -288,6 +290,8 @@ TEST_F(OptionsSettableTest, DBOptionsAllFieldsSettable) {
                              "WAL_ttl_seconds=4295008036;"
                              "WAL_size_limit_MB=4295036161;"
                              "max_write_batch_group_size_bytes=1048576;"
+                             "adaptive_write_group_size=true;"
+                             "write_group_max_wait_usec=50;"
                              "wal_dir=path/to/wal_dir;"
                              "db_write_buffer_size=2587;"
                              "max_subcompactions=64330;"
@@ -353,6 +357,7 @@ TEST_F(OptionsSettableTest, DBOptionsAllFieldsSettable) {
                              "two_write_queues=false;"
                              "manual_wal_flush=false;"
                              "wal_compression=kZSTD;"
+                             "wal_compression_max_dict_bytes=16384;"
                              "seq_per_batch=false;"
                              "atomic_flush=false;"
                              "avoid_unnecessary_blocking_io=false;"
@@ -511,10 +516,12 @@ TEST_F(OptionsSettableTest, ColumnFamilyOptionsAllFieldsSettable) {
       "merge_operator=aabcxehazrMergeOperator;"
       "memtable_prefix_bloom_size_ratio=0.4642;"
       "memtable_whole_key_filtering=true;"
+      "memtable_hash_index_size_ratio=0.05;"
       "memtable_insert_with_hint_prefix_extractor=rocksdb.CappedPrefix.13;"
       "check_flush_compaction_key_order=false;"
       "paranoid_file_checks=true;"
       "force_consistency_checks=true;"
+      "max_flush_partitions=4;"
       "inplace_update_num_locks=7429;"
       "experimental_mempurge_threshold=0.0001;"
       "optimize_filters_for_hits=false;"
@@ -524,6 +531,7 @@ TEST_F(OptionsSettableTest, ColumnFamilyOptionsAllFieldsSettable) {
       "compaction_style=kCompactionStyleFIFO;"
       "compaction_pri=kMinOverlappingRatio;"
       "hard_pending_compaction_bytes_limit=0;"
+      "write_throttle_start_ratio=0.5;"
       "disable_auto_compactions=false;"
       "report_bg_io_stats=true;"
       "ttl=60;"
@@ -131,6 +131,7 @@ LIB_SOURCES =                                                   \
   memory/memkind_kmem_allocator.cc                              \
   memory/memory_allocator.cc                                    \
   memtable/alloc_tracker.cc                                     \
+  memtable/btreerep.cc                                          \
   memtable/hash_linklist_rep.cc                                 \
   memtable/hash_skiplist_rep.cc                                 \
   memtable/skiplistrep.cc                                       \
@@ -191,6 +192,7 @@ LIB_SOURCES =                                                   \
   table/block_based/partitioned_index_iterator.cc               \
   table/block_based/partitioned_index_reader.cc                 \
   table/block_based/reader_common.cc                            \
+  table/block_based/restart_key_prefixes.cc                     \
   table/block_based/uncompression_dict_reader.cc                \
   table/block_fetcher.cc                                        \
   table/cuckoo/cuckoo_table_builder.cc                          \
@@ -539,6 +541,7 @@ TEST_MAIN_SOURCES =                                                     \
   logging/event_logger_test.cc                                          \
   memory/arena_test.cc                                                  \
   memory/memory_allocator_test.cc                                       \
+  memtable/concurrent_btree_test.cc                                     \
   memtable/inlineskiplist_test.cc                                       \
   memtable/skiplist_test.cc                                             \
   memtable/write_buffer_manager_test.cc                                 \
@@ -770,6 +770,9 @@ bool BlockIter<TValue>::BinarySeek(const Slice& target, uint32_t* index,
   // - Any restart keys after index `right` are strictly greater than the target
   //   key.
   int64_t left = -1, right = num_restarts_ - 1;
+  if (restart_key_prefixes_ != nullptr) {
+    NarrowBinarySeekByPrefix(target, &left, &right);
+  }
   while (left != right) {
     // The `mid` is computed by rounding up so it lands in (`left`, `right`].
     int64_t mid = left + (right - left + 1) / 2;
@@ -809,6 +812,28 @@ bool BlockIter<TValue>::BinarySeek(const Slice& target, uint32_t* index,
   return true;
 }
 
+template <class TValue>
+void BlockIter<TValue>::NarrowBinarySeekByPrefix(const Slice& target,
+                                                 int64_t* left,
+                                                 int64_t* right) {
+  assert(restart_key_prefixes_ != nullptr);
+  Slice user_key = target;
+  if (!raw_key_.IsUserKey()) {
+    if (target.size() < kNumInternalBytes) {
+      return;
+    }
+    user_key = ExtractUserKey(target);
+  }
+  // Restart keys with a smaller prefix are strictly smaller than `target`, and
+  // those with a larger prefix are strictly greater. Only the restart keys
+  // sharing `target`'s prefix need to be decoded and compared.
+  uint32_t lower, upper;
+  restart_key_prefixes_->Seek(RestartKeyPrefixes::UserKeyPrefix(user_key),
+                              &lower, &upper);
+  *left = static_cast<int64_t>(lower) - 1;
+  *right = static_cast<int64_t>(upper) - 1;
+}
+
 // Compare target key and the block key of the block of `block_index`.
 // Return -1 if error.
 int IndexBlockIter::CompareBlockKey(uint32_t block_index, const Slice& target) {
@@ -1035,6 +1060,49 @@ Block::Block(BlockContents&& contents, size_t read_amp_bytes_per_bit,
   }
 }
 
+void Block::InitializeRestartKeyPrefixes(bool key_includes_seq,
+                                         bool value_is_full, bool build_model) {
+  if (size_ < 2 * sizeof(uint32_t) || num_restarts_ == 0) {
+    return;
+  }
+  std::unique_ptr<uint64_t[]> prefixes(new uint64_t[num_restarts_]);
+  const char* limit = data_ + restart_offset_;
+  for (uint32_t i = 0; i < num_restarts_; ++i) {
+    uint32_t offset =
+        DecodeFixed32(data_ + restart_offset_ + i * sizeof(uint32_t));
+    if (offset >= restart_offset_) {
+      return;
+    }
+    uint32_t shared, non_shared, value_length;
+    const char* key_ptr =
+        value_is_full
+            ? CheckAndDecodeEntry()(data_ + offset, limit, &shared,
+                                    &non_shared, &value_length)
+            : DecodeKeyV4()(data_ + offset, limit, &shared, &non_shared);
+    if (key_ptr == nullptr || shared != 0 ||
+        static_cast<uint32_t>(limit - key_ptr) < non_shared) {
+      return;
+    }
+    Slice key(key_ptr, static_cast<size_t>(non_shared));
+    if (key_includes_seq) {
+      if (key.size() < kNumInternalBytes) {
+        return;
+      }
+      key = ExtractUserKey(key);
+    }
+    prefixes[i] = RestartKeyPrefixes::UserKeyPrefix(key);
+    if (i > 0 && prefixes[i] < prefixes[i - 1]) {
+      // Not sorted as expected; searching on the prefixes would be wrong.
+      return;
+    }
+  }
+  restart_key_prefixes_.reset(new RestartKeyPrefixes(
+      std::move(prefixes), num_restarts_, key_includes_seq));
+  if (build_model) {
+    restart_key_prefixes_->BuildModel();
+  }
+}
+
 MetaBlockIter* Block::NewMetaIterator(bool block_contents_pinned) {
   MetaBlockIter* iter = new MetaBlockIter();
   if (size_ < 2 * sizeof(uint32_t)) {
@@ -1072,7 +1140,8 @@ DataBlockIter* Block::NewDataIterator(const Comparator* raw_ucmp,
     ret_iter->Initialize(
         raw_ucmp, data_, restart_offset_, num_restarts_, global_seqno,
         read_amp_bitmap_.get(), block_contents_pinned,
-        data_block_hash_index_.Valid() ? &data_block_hash_index_ : nullptr);
+        data_block_hash_index_.Valid() ? &data_block_hash_index_ : nullptr,
+        restart_key_prefixes_.get());
     if (read_amp_bitmap_) {
       if (read_amp_bitmap_->GetStatistics() != stats) {
         // DB changed the Statistics pointer, we need to notify read_amp_bitmap_
@@ -1106,10 +1175,17 @@ IndexBlockIter* Block::NewIndexIterator(
   } else {
     BlockPrefixIndex* prefix_index_ptr =
         total_order_seek ? nullptr : prefix_index;
+    // The prefixes are only usable if they were built for the same key
+    // format.
+    const RestartKeyPrefixes* restart_key_prefixes =
+        restart_key_prefixes_ &&
+                restart_key_prefixes_->key_includes_seq() == key_includes_seq
+            ? restart_key_prefixes_.get()
+            : nullptr;
     ret_iter->Initialize(raw_ucmp, data_, restart_offset_, num_restarts_,
                          global_seqno, prefix_index_ptr, have_first_key,
-                         key_includes_seq, value_is_full,
-                         block_contents_pinned);
+                         key_includes_seq, value_is_full, block_contents_pinned,
+                         restart_key_prefixes);
   }
 
   return ret_iter;
@@ -1125,6 +1201,9 @@ size_t Block::ApproximateMemoryUsage() const {
   if (read_amp_bitmap_) {
     usage += read_amp_bitmap_->ApproximateMemoryUsage();
   }
+  if (restart_key_prefixes_) {
+    usage += restart_key_prefixes_->ApproximateMemoryUsage();
+  }
   return usage;
 }
 
@@ -23,6 +23,7 @@
 #include "rocksdb/table.h"
 #include "table/block_based/block_prefix_index.h"
 #include "table/block_based/data_block_hash_index.h"
+#include "table/block_based/restart_key_prefixes.h"
 #include "table/format.h"
 #include "table/internal_iterator.h"
 #include "test_util/sync_point.h"
@@ -171,6 +172,18 @@ class Block {
 
   BlockBasedTableOptions::DataBlockIndexType IndexType() const;
 
+  // Builds the in-memory restart key prefixes used to narrow restart point
+  // binary search (see BlockBasedTableOptions::data_block_restart_key_prefixes
+  // and BlockBasedTableOptions::index_block_learned_search). Only valid for
+  // data or index blocks whose keys are ordered by BytewiseComparator().
+  // `key_includes_seq` and `value_is_full` describe the block format as for
+  // NewIndexIterator(); `build_model` additionally fits a learned position
+  // model over the prefixes. Leaves the block unchanged if the restart keys
+  // cannot be decoded.
+  void InitializeRestartKeyPrefixes(bool key_includes_seq = true,
+                                    bool value_is_full = true,
+                                    bool build_model = false);
+
   // raw_ucmp is a raw (i.e., not wrapped by `UserComparatorWrapper`) user key
   // comparator.
   //
@@ -248,6 +261,8 @@ class Block {
   uint32_t num_restarts_;
   std::unique_ptr<BlockReadAmpBitmap> read_amp_bitmap_;
   DataBlockHashIndex data_block_hash_index_;
+  // nullptr if not built. See `InitializeRestartKeyPrefixes()`.
+  std::unique_ptr<RestartKeyPrefixes> restart_key_prefixes_;
 };
 
 // A `BlockIter` iterates over the entries in a `Block`'s data buffer. The
@@ -383,6 +398,9 @@ class BlockIter : public InternalIteratorBase<TValue> {
   // e.g. PinnableSlice, the pointer to the bytes will still be valid.
   bool block_contents_pinned_;
   SequenceNumber global_seqno_;
+  // If not nullptr, the restart keys are ordered by BytewiseComparator() and
+  // `BinarySeek()` may use their prefixes to narrow its search.
+  const RestartKeyPrefixes* restart_key_prefixes_ = nullptr;
 
   virtual void SeekToFirstImpl() = 0;
   virtual void SeekToLastImpl() = 0;
@@ -410,6 +428,7 @@ class BlockIter : public InternalIteratorBase<TValue> {
     global_seqno_ = global_seqno;
     block_contents_pinned_ = block_contents_pinned;
     cache_handle_ = nullptr;
+    restart_key_prefixes_ = nullptr;
   }
 
   // Must be called every time a key is found that needs to be returned to user,
@@ -482,6 +501,11 @@ class BlockIter : public InternalIteratorBase<TValue> {
   void CorruptionError();
 
  protected:
+  // Narrows the initial `[*left, *right]` restart interval of `BinarySeek()`
+  // using `restart_key_prefixes_`, preserving its loop invariants.
+  void NarrowBinarySeekByPrefix(const Slice& target, int64_t* left,
+                                int64_t* right);
+
   template <typename DecodeKeyFunc>
   inline bool BinarySeek(const Slice& target, uint32_t* index,
                          bool* is_index_key_result);
@@ -507,13 +531,15 @@ class DataBlockIter final : public BlockIter<Slice> {
                   SequenceNumber global_seqno,
                   BlockReadAmpBitmap* read_amp_bitmap,
                   bool block_contents_pinned,
-                  DataBlockHashIndex* data_block_hash_index) {
+                  DataBlockHashIndex* data_block_hash_index,
+                  const RestartKeyPrefixes* restart_key_prefixes = nullptr) {
     InitializeBase(raw_ucmp, data, restarts, num_restarts, global_seqno,
                    block_contents_pinned);
     raw_key_.SetIsUserKey(false);
     read_amp_bitmap_ = read_amp_bitmap;
     last_bitmap_offset_ = current_ + 1;
     data_block_hash_index_ = data_block_hash_index;
+    restart_key_prefixes_ = restart_key_prefixes;
   }
 
   Slice value() const override {
@@ -633,11 +659,13 @@ class IndexBlockIter final : public BlockIter<IndexValue> {
                   uint32_t restarts, uint32_t num_restarts,
                   SequenceNumber global_seqno, BlockPrefixIndex* prefix_index,
                   bool have_first_key, bool key_includes_seq,
-                  bool value_is_full, bool block_contents_pinned) {
+                  bool value_is_full, bool block_contents_pinned,
+                  const RestartKeyPrefixes* restart_key_prefixes = nullptr) {
     InitializeBase(raw_ucmp, data, restarts, num_restarts,
                    kDisableGlobalSequenceNumber, block_contents_pinned);
     raw_key_.SetIsUserKey(!key_includes_seq);
     prefix_index_ = prefix_index;
+    restart_key_prefixes_ = restart_key_prefixes;
     value_delta_encoded_ = !value_is_full;
     have_first_key_ = have_first_key;
     if (have_first_key_ && global_seqno != kDisableGlobalSequenceNumber) {
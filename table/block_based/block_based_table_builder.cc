@@ -51,6 +51,7 @@
 #include "table/table_builder.h"
 #include "util/coding.h"
 #include "util/compression.h"
+#include "util/crc32c.h"
 #include "util/stop_watch.h"
 #include "util/string_util.h"
 #include "util/work_queue.h"
@@ -444,7 +445,8 @@ struct BlockBasedTableBuilder::Rep {
         flush_block_policy(
             table_options.flush_block_policy_factory->NewFlushBlockPolicy(
                 table_options, data_block)),
-        create_context(&table_options, ioptions.stats,
+        create_context(&table_options, ioptions.user_comparator,
+                       ioptions.stats,
                        compression_type == kZSTD ||
                            compression_type == kZSTDNotFinalCompression),
         status_ok(true),
@@ -1249,20 +1251,33 @@ void BlockBasedTableBuilder::WriteMaybeCompressedBlock(
     assert(type == kNoCompression);
   }
 
+  std::array<char, kBlockTrailerSize> trailer;
+  trailer[0] = type;
+  uint32_t checksum;
+  // With crc32c block checksums, the crc32c of the block contents is handed
+  // to the file writer so that checksum handoff and a crc32c file checksum
+  // do not hash the block again.
+  uint32_t contents_crc32c = 0;
+  if (r->table_options.checksum == kCRC32c) {
+    contents_crc32c =
+        crc32c::Value(block_contents.data(), block_contents.size());
+    // Same as ComputeBuiltinChecksumWithLastByte()
+    checksum = crc32c::Mask(crc32c::Extend(contents_crc32c, &trailer[0], 1));
+  } else {
+    checksum = ComputeBuiltinChecksumWithLastByte(
+        r->table_options.checksum, block_contents.data(),
+        block_contents.size(),
+        /*last_byte*/ type);
+  }
+
   {
-    IOStatus io_s = r->file->Append(block_contents);
+    IOStatus io_s = r->file->Append(block_contents, contents_crc32c);
     if (!io_s.ok()) {
       r->SetIOStatus(io_s);
       return;
     }
   }
 
-  std::array<char, kBlockTrailerSize> trailer;
-  trailer[0] = type;
-  uint32_t checksum = ComputeBuiltinChecksumWithLastByte(
-      r->table_options.checksum, block_contents.data(), block_contents.size(),
-      /*last_byte*/ type);
-
   if (block_type == BlockType::kFilter) {
     Status s = r->filter_builder->MaybePostVerifyFilter(block_contents);
     if (!s.ok()) {
@@ -1509,6 +1524,12 @@ void BlockBasedTableBuilder::WriteIndexBlock(
   } else if (ok() && !index_builder_status.ok()) {
     rep_->SetStatus(index_builder_status);
   }
+  // The index key format is final now, for parsing index blocks inserted
+  // into the block cache.
+  rep_->create_context.index_key_includes_seq =
+      rep_->index_builder->seperator_is_key_plus_seq();
+  rep_->create_context.index_value_is_full =
+      !rep_->use_delta_encoding_for_index_values;
   if (ok()) {
     for (const auto& item : index_blocks.meta_blocks) {
       BlockHandle block_handle;
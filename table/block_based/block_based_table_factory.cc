@@ -271,6 +271,15 @@ static std::unordered_map<std::string, OptionTypeInfo>
                    data_block_hash_table_util_ratio),
           OptionType::kDouble, OptionVerificationType::kNormal,
           OptionTypeFlags::kNone}},
+        {"data_block_restart_key_prefixes",
+         {offsetof(struct BlockBasedTableOptions,
+                   data_block_restart_key_prefixes),
+          OptionType::kBoolean, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
+        {"index_block_learned_search",
+         {offsetof(struct BlockBasedTableOptions, index_block_learned_search),
+          OptionType::kBoolean, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
         {"checksum",
          {offsetof(struct BlockBasedTableOptions, checksum),
           OptionType::kChecksumType, OptionVerificationType::kNormal,
@@ -753,6 +762,12 @@ std::string BlockBasedTableFactory::GetPrintableOptions() const {
   snprintf(buffer, kBufferSize, "  data_block_hash_table_util_ratio: %lf\n",
            table_options_.data_block_hash_table_util_ratio);
   ret.append(buffer);
+  snprintf(buffer, kBufferSize, "  data_block_restart_key_prefixes: %d\n",
+           table_options_.data_block_restart_key_prefixes);
+  ret.append(buffer);
+  snprintf(buffer, kBufferSize, "  index_block_learned_search: %d\n",
+           table_options_.index_block_learned_search);
+  ret.append(buffer);
   snprintf(buffer, kBufferSize, "  checksum: %d\n", table_options_.checksum);
   ret.append(buffer);
   snprintf(buffer, kBufferSize, "  no_block_cache: %d\n",
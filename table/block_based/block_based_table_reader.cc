@@ -670,9 +670,11 @@ Status BlockBasedTable::Open(
            CompressionTypeToString(kZSTD) ||
        rep->table_properties->compression_name ==
            CompressionTypeToString(kZSTDNotFinalCompression));
-  rep->create_context =
-      BlockCreateContext(&rep->table_options, rep->ioptions.stats,
-                         blocks_definitely_zstd_compressed);
+  rep->create_context = BlockCreateContext(
+      &rep->table_options, rep->internal_comparator.user_comparator(),
+      rep->ioptions.stats, blocks_definitely_zstd_compressed);
+  rep->create_context.index_key_includes_seq = rep->index_key_includes_seq;
+  rep->create_context.index_value_is_full = rep->index_value_is_full;
 
   // Check expected unique id if provided
   if (expected_unique_id != kNullUniqueId64x2) {
@@ -2248,6 +2250,26 @@ Status BlockBasedTable::Prefetch(const Slice* const begin,
   return Status::OK();
 }
 
+void BlockBasedTable::PrefetchFirstDataBlocks(const ReadOptions& read_options) {
+  size_t readahead_size = read_options.readahead_size > 0
+                              ? read_options.readahead_size
+                              : rep_->table_options.max_auto_readahead_size;
+  // Data blocks are laid out at the start of the file, ahead of all meta
+  // blocks.
+  if (rep_->table_properties) {
+    readahead_size = static_cast<size_t>(
+        std::min<uint64_t>(readahead_size, rep_->table_properties->data_size));
+  }
+  if (readahead_size == 0) {
+    return;
+  }
+  // Errors (e.g. NotSupported for file systems or direct I/O without a
+  // readahead hint) only mean the scan reads the blocks on demand.
+  IOStatus s = rep_->file->Prefetch(/*offset=*/0, readahead_size,
+                                    read_options.rate_limiter_priority);
+  s.PermitUncheckedError();
+}
+
 Status BlockBasedTable::VerifyChecksum(const ReadOptions& read_options,
                                        TableReaderCaller caller) {
   Status s;
@@ -155,6 +155,11 @@ class BlockBasedTable : public TableReader {
   // IO or iteration error.
   Status Prefetch(const Slice* begin, const Slice* end) override;
 
+  // Issues a readahead through FSRandomAccessFile::Prefetch() for up to
+  // max_auto_readahead_size bytes (or ReadOptions::readahead_size if set) of
+  // data blocks from the start of the file.
+  void PrefetchFirstDataBlocks(const ReadOptions& read_options) override;
+
   // Given a key, return an approximate byte offset in the file where
   // the data for that key begins (or would begin if the key were
   // present in the file). The returned value is in terms of file
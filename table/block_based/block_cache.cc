@@ -5,17 +5,30 @@
 
 #include "table/block_based/block_cache.h"
 
+#include "rocksdb/comparator.h"
+
 namespace ROCKSDB_NAMESPACE {
 
 void BlockCreateContext::Create(std::unique_ptr<Block_kData>* parsed_out,
                                 BlockContents&& block) {
   parsed_out->reset(new Block_kData(
       std::move(block), table_options->read_amp_bytes_per_bit, statistics));
+  if (table_options->data_block_restart_key_prefixes &&
+      raw_ucmp == BytewiseComparator()) {
+    (*parsed_out)->InitializeRestartKeyPrefixes();
+  }
 }
 void BlockCreateContext::Create(std::unique_ptr<Block_kIndex>* parsed_out,
                                 BlockContents&& block) {
   parsed_out->reset(new Block_kIndex(std::move(block),
                                      /*read_amp_bytes_per_bit*/ 0, statistics));
+  if (table_options->index_block_learned_search &&
+      raw_ucmp == BytewiseComparator()) {
+    (*parsed_out)
+        ->InitializeRestartKeyPrefixes(index_key_includes_seq,
+                                       index_value_is_full,
+                                       /*build_model=*/true);
+  }
 }
 void BlockCreateContext::Create(
     std::unique_ptr<Block_kFilterPartitionIndex>* parsed_out,
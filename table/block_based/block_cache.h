@@ -70,14 +70,20 @@ class Block_kMetaIndex : public Block {
 struct BlockCreateContext : public Cache::CreateContext {
   BlockCreateContext() {}
   BlockCreateContext(const BlockBasedTableOptions* _table_options,
-                     Statistics* _statistics, bool _using_zstd)
+                     const Comparator* _raw_ucmp, Statistics* _statistics,
+                     bool _using_zstd)
       : table_options(_table_options),
+        raw_ucmp(_raw_ucmp),
         statistics(_statistics),
         using_zstd(_using_zstd) {}
 
   const BlockBasedTableOptions* table_options = nullptr;
+  const Comparator* raw_ucmp = nullptr;
   Statistics* statistics = nullptr;
   bool using_zstd = false;
+  // Format of index block keys and values, see Block::NewIndexIterator()
+  bool index_key_includes_seq = true;
+  bool index_value_is_full = true;
 
   // For TypedCacheInterface
   template <typename TBlocklike>
@@ -28,6 +28,7 @@
 #include "table/format.h"
 #include "test_util/testharness.h"
 #include "test_util/testutil.h"
+#include "util/math.h"
 #include "util/random.h"
 
 namespace ROCKSDB_NAMESPACE {
@@ -492,6 +493,147 @@ TEST_F(BlockTest, ReadAmpBitmapPow2) {
   ASSERT_EQ(BlockReadAmpBitmap(100, 35, stats.get()).GetBytesPerBit(), 32u);
 }
 
+TEST_F(BlockTest, RestartKeyPrefixes) {
+  Random rnd(301);
+  Options options = Options();
+
+  // User keys of varying length over a tiny alphabet, including '\0', so that
+  // many restart keys share (or tie on zero-padded) 8-byte prefixes.
+  std::set<std::string> user_keys;
+  while (user_keys.size() < 2000) {
+    std::string k(rnd.Uniform(13), '\0');
+    for (auto &c : k) {
+      c = "\0ab"[rnd.Uniform(3)];
+    }
+    user_keys.insert(k);
+  }
+  std::vector<std::string> keys;
+  std::vector<std::string> values;
+  for (const auto &user_key : user_keys) {
+    // Some user keys get several versions
+    int num_versions = 1 + (rnd.OneIn(4) ? rnd.Uniform(3) : 0);
+    for (int v = num_versions; v > 0; --v) {
+      std::string k = user_key;
+      AppendInternalKeyFooter(&k, 100 + v /* seqno */, kTypeValue);
+      keys.push_back(k);
+      values.push_back(rnd.RandomString(10));
+    }
+  }
+
+  for (int restart_interval : {1, 4, 16}) {
+    BlockBuilder builder(restart_interval);
+    for (size_t i = 0; i < keys.size(); ++i) {
+      builder.Add(keys[i], values[i]);
+    }
+    Slice rawblock = builder.Finish();
+
+    BlockContents contents;
+    contents.data = rawblock;
+    Block reader(std::move(contents));
+    BlockContents prefix_contents;
+    prefix_contents.data = rawblock;
+    Block prefix_reader(std::move(prefix_contents));
+    prefix_reader.InitializeRestartKeyPrefixes();
+
+    std::unique_ptr<DataBlockIter> iter(reader.NewDataIterator(
+        options.comparator, kDisableGlobalSequenceNumber));
+    std::unique_ptr<DataBlockIter> prefix_iter(prefix_reader.NewDataIterator(
+        options.comparator, kDisableGlobalSequenceNumber));
+
+    for (int i = 0; i < 5000; ++i) {
+      std::string target;
+      if (rnd.OneIn(2)) {
+        target = keys[rnd.Uniform(static_cast<int>(keys.size()))];
+      } else {
+        target.assign(rnd.Uniform(14), '\0');
+        for (auto &c : target) {
+          c = "\0abc"[rnd.Uniform(4)];
+        }
+        AppendInternalKeyFooter(&target, rnd.Uniform(200), kTypeValue);
+      }
+
+      iter->Seek(target);
+      prefix_iter->Seek(target);
+      ASSERT_EQ(iter->Valid(), prefix_iter->Valid());
+      if (iter->Valid()) {
+        ASSERT_EQ(iter->key(), prefix_iter->key());
+        ASSERT_EQ(iter->value(), prefix_iter->value());
+      }
+
+      iter->SeekForPrev(target);
+      prefix_iter->SeekForPrev(target);
+      ASSERT_EQ(iter->Valid(), prefix_iter->Valid());
+      if (iter->Valid()) {
+        ASSERT_EQ(iter->key(), prefix_iter->key());
+      }
+    }
+    ASSERT_OK(iter->status());
+    ASSERT_OK(prefix_iter->status());
+  }
+}
+
+TEST_F(BlockTest, RestartKeyPrefixesModel) {
+  Random rnd(301);
+  for (int distribution = 0; distribution < 3; ++distribution) {
+    const uint32_t kNumRestarts = 5000;
+    std::vector<uint64_t> values;
+    uint64_t next = 0;
+    for (uint32_t i = 0; i < kNumRestarts; ++i) {
+      switch (distribution) {
+        case 0:  // Evenly spaced
+          next += 1000;
+          break;
+        case 1:  // Clustered, with runs of duplicates
+          if (!rnd.OneIn(3)) {
+            next += rnd.OneIn(50) ? 1 << 30 : 1 + rnd.Uniform(10);
+          }
+          break;
+        default:  // Random
+          next = rnd.Next64();
+          break;
+      }
+      values.push_back(next);
+    }
+    std::sort(values.begin(), values.end());
+    std::unique_ptr<uint64_t[]> prefixes(new uint64_t[kNumRestarts]);
+    std::copy(values.begin(), values.end(), prefixes.get());
+    RestartKeyPrefixes restart_key_prefixes(std::move(prefixes), kNumRestarts,
+                                            /*key_includes_seq=*/true);
+    size_t usage_without_model = restart_key_prefixes.ApproximateMemoryUsage();
+    restart_key_prefixes.BuildModel();
+    if (distribution == 0) {
+      ASSERT_TRUE(restart_key_prefixes.has_model());
+    }
+    if (restart_key_prefixes.has_model()) {
+      ASSERT_GT(restart_key_prefixes.ApproximateMemoryUsage(),
+                usage_without_model);
+    }
+
+    for (int i = 0; i < 10000; ++i) {
+      uint64_t target;
+      switch (rnd.Uniform(3)) {
+        case 0:
+          target = values[rnd.Uniform(kNumRestarts)];
+          break;
+        case 1:
+          target = values[rnd.Uniform(kNumRestarts)] + rnd.Uniform(3) - 1;
+          break;
+        default:
+          target = rnd.Next64();
+          break;
+      }
+      uint32_t lower, upper;
+      restart_key_prefixes.Seek(target, &lower, &upper);
+      ASSERT_EQ(std::lower_bound(values.begin(), values.end(), target) -
+                    values.begin(),
+                lower);
+      ASSERT_EQ(std::upper_bound(values.begin(), values.end(), target) -
+                    values.begin(),
+                upper);
+    }
+  }
+}
+
 class IndexBlockTest
     : public testing::Test,
       public testing::WithParamInterface<std::tuple<bool, bool>> {
@@ -612,6 +754,106 @@ TEST_P(IndexBlockTest, IndexValueEncodingTest) {
   delete iter;
 }
 
+TEST_P(IndexBlockTest, LearnedSearch) {
+  Random rnd(301);
+  Options options = Options();
+  const bool kTotalOrderSeek = true;
+  const bool kValueIsFull = !useValueDeltaEncoding();
+  IndexBlockIter *kNullIter = nullptr;
+  Statistics *kNullStats = nullptr;
+
+  for (bool includes_seq : {true, false}) {
+    for (bool regular_keys : {true, false}) {
+      // Regularly spaced big-endian integer keys suit the model, random keys
+      // mostly exercise the fallback.
+      std::set<std::string> user_keys;
+      uint64_t next = rnd.Next64() >> 8;
+      while (user_keys.size() < 2000) {
+        std::string k;
+        if (regular_keys) {
+          next += 1000 + rnd.Uniform(100);
+          PutFixed64(&k, EndianSwapValue(next));
+        } else {
+          k = test::RandomKey(&rnd, 1 + rnd.Uniform(12));
+        }
+        user_keys.insert(k);
+      }
+      std::vector<std::string> separators;
+      for (const auto &user_key : user_keys) {
+        separators.push_back(user_key);
+        if (includes_seq) {
+          AppendInternalKeyFooter(&separators.back(), 0, kTypeValue);
+        }
+      }
+
+      BlockBuilder builder(1, true /* use_delta_encoding */,
+                           useValueDeltaEncoding());
+      BlockHandle last_encoded_handle;
+      for (size_t i = 0; i < separators.size(); i++) {
+        const uint64_t kSize = 4000;
+        IndexValue entry(
+            BlockHandle(i * (kSize + BlockBasedTable::kBlockTrailerSize),
+                        kSize),
+            separators[i]);
+        std::string encoded_entry;
+        std::string delta_encoded_entry;
+        entry.EncodeTo(&encoded_entry, includeFirstKey(), nullptr);
+        if (useValueDeltaEncoding() && i > 0) {
+          entry.EncodeTo(&delta_encoded_entry, includeFirstKey(),
+                         &last_encoded_handle);
+        }
+        last_encoded_handle = entry.handle;
+        const Slice delta_encoded_entry_slice(delta_encoded_entry);
+        builder.Add(separators[i], encoded_entry, &delta_encoded_entry_slice);
+      }
+      Slice rawblock = builder.Finish();
+
+      BlockContents contents;
+      contents.data = rawblock;
+      Block reader(std::move(contents));
+      BlockContents learned_contents;
+      learned_contents.data = rawblock;
+      Block learned_reader(std::move(learned_contents));
+      learned_reader.InitializeRestartKeyPrefixes(includes_seq, kValueIsFull,
+                                                  /*build_model=*/true);
+
+      std::unique_ptr<IndexBlockIter> iter(reader.NewIndexIterator(
+          options.comparator, kDisableGlobalSequenceNumber, kNullIter,
+          kNullStats, kTotalOrderSeek, includeFirstKey(), includes_seq,
+          kValueIsFull));
+      std::unique_ptr<IndexBlockIter> learned_iter(
+          learned_reader.NewIndexIterator(
+              options.comparator, kDisableGlobalSequenceNumber, kNullIter,
+              kNullStats, kTotalOrderSeek, includeFirstKey(), includes_seq,
+              kValueIsFull));
+
+      for (int i = 0; i < 5000; ++i) {
+        // Index iterators are always sought with internal keys
+        std::string target;
+        if (rnd.OneIn(2)) {
+          target = *std::next(user_keys.begin(),
+                              rnd.Uniform(static_cast<int>(user_keys.size())));
+        } else if (regular_keys) {
+          PutFixed64(&target, EndianSwapValue(rnd.Next64() >> 8));
+        } else {
+          target = test::RandomKey(&rnd, rnd.Uniform(13));
+        }
+        AppendInternalKeyFooter(&target, rnd.Uniform(10), kTypeValue);
+        iter->Seek(target);
+        learned_iter->Seek(target);
+        ASSERT_EQ(iter->Valid(), learned_iter->Valid());
+        if (iter->Valid()) {
+          ASSERT_EQ(iter->key(), learned_iter->key());
+          ASSERT_EQ(iter->value().handle.offset(),
+                    learned_iter->value().handle.offset());
+        }
+      }
+      ASSERT_OK(iter->status());
+      ASSERT_OK(learned_iter->status());
+    }
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(P, IndexBlockTest,
                         ::testing::Values(std::make_tuple(false, false),
                                           std::make_tuple(false, true),
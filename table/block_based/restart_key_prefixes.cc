@@ -0,0 +1,134 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "table/block_based/restart_key_prefixes.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#include "port/port.h"
+#include "util/math.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+uint64_t RestartKeyPrefixes::UserKeyPrefix(const Slice& user_key) {
+  uint64_t prefix = 0;
+  memcpy(&prefix, user_key.data(),
+         std::min(user_key.size(), sizeof(uint64_t)));
+  return port::kLittleEndian ? EndianSwapValue(prefix) : prefix;
+}
+
+RestartKeyPrefixes::RestartKeyPrefixes(std::unique_ptr<uint64_t[]>&& prefixes,
+                                       uint32_t num_restarts,
+                                       bool key_includes_seq)
+    : prefixes_(std::move(prefixes)),
+      num_restarts_(num_restarts),
+      key_includes_seq_(key_includes_seq) {
+  assert(std::is_sorted(prefixes_.get(), prefixes_.get() + num_restarts_));
+}
+
+void RestartKeyPrefixes::BuildModel() {
+  if (num_restarts_ < kModelMinRestarts) {
+    return;
+  }
+  // Greedy "shrinking cone" fit: extend the current segment while some slope
+  // keeps every point of the segment within kModelMaxError of its position.
+  // Only the first restart point of each distinct prefix is a model point,
+  // since that is the position a lookup has to land near.
+  constexpr double kMaxError = kModelMaxError;
+  constexpr double kInfinity = std::numeric_limits<double>::infinity();
+  auto pick_slope = [](double lo, double hi) {
+    return hi == kInfinity ? lo : (lo + hi) / 2;
+  };
+
+  std::vector<Segment> segments;
+  uint64_t x0 = prefixes_[0];
+  uint32_t y0 = 0;
+  double slope_lo = 0;
+  double slope_hi = kInfinity;
+  for (uint32_t i = 1; i < num_restarts_; ++i) {
+    uint64_t x = prefixes_[i];
+    if (x == prefixes_[i - 1]) {
+      continue;
+    }
+    double dx = static_cast<double>(x - x0);
+    double dy = static_cast<double>(i - y0);
+    double lo = std::max(slope_lo, (dy - kMaxError) / dx);
+    double hi = std::min(slope_hi, (dy + kMaxError) / dx);
+    if (lo > hi) {
+      segments.push_back({x0, y0, pick_slope(slope_lo, slope_hi)});
+      if (segments.size() > num_restarts_ / kModelMinRestartsPerSegment) {
+        // Keys are too irregular for the model to pay off.
+        return;
+      }
+      x0 = x;
+      y0 = i;
+      slope_lo = 0;
+      slope_hi = kInfinity;
+    } else {
+      slope_lo = lo;
+      slope_hi = hi;
+    }
+  }
+  segments.push_back({x0, y0, pick_slope(slope_lo, slope_hi)});
+  segments.shrink_to_fit();
+  segments_ = std::move(segments);
+}
+
+void RestartKeyPrefixes::Seek(uint64_t target_prefix, uint32_t* lower,
+                              uint32_t* upper) const {
+  const uint64_t* begin = prefixes_.get();
+  const uint64_t* end = begin + num_restarts_;
+  // Search window, the whole array unless the model predicts a position.
+  const uint64_t* window_begin = begin;
+  const uint64_t* window_end = end;
+  if (!segments_.empty()) {
+    auto seg = std::upper_bound(
+        segments_.begin(), segments_.end(), target_prefix,
+        [](uint64_t t, const Segment& s) { return t < s.first_prefix; });
+    if (seg == segments_.begin()) {
+      // Smaller than every prefix
+      window_end = begin;
+    } else {
+      --seg;
+      double pos =
+          seg->first_index +
+          seg->slope * static_cast<double>(target_prefix - seg->first_prefix);
+      uint32_t predicted = static_cast<uint32_t>(
+          std::min(pos, static_cast<double>(num_restarts_)));
+      // One more on each side as a target between two model points lands
+      // between their predictions.
+      window_begin = begin + (predicted > kModelMaxError + 1
+                                  ? predicted - kModelMaxError - 1
+                                  : 0);
+      window_end =
+          begin + std::min(num_restarts_, predicted + kModelMaxError + 2);
+    }
+  }
+
+  const uint64_t* l = std::lower_bound(window_begin, window_end, target_prefix);
+  // Fall back to the rest of the array if the prediction was off.
+  if (l != begin && l[-1] >= target_prefix) {
+    l = std::lower_bound(begin, l, target_prefix);
+  } else if (l != end && *l < target_prefix) {
+    l = std::lower_bound(l, end, target_prefix);
+  }
+  const uint64_t* u =
+      std::upper_bound(l, std::max(l, window_end), target_prefix);
+  if (u != end && *u <= target_prefix) {
+    u = std::upper_bound(u, end, target_prefix);
+  }
+  *lower = static_cast<uint32_t>(l - begin);
+  *upper = static_cast<uint32_t>(u - begin);
+}
+
+size_t RestartKeyPrefixes::ApproximateMemoryUsage() const {
+  return sizeof(*this) + num_restarts_ * sizeof(uint64_t) +
+         segments_.capacity() * sizeof(Segment);
+}
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -0,0 +1,81 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "rocksdb/slice.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// RestartKeyPrefixes is an optional in-memory companion of a parsed Block
+// whose keys are ordered by BytewiseComparator(). It holds, for every restart
+// point, the first 8 bytes of that restart key's user key as a big-endian
+// integer, so the restart-point binary search can run over a contiguous
+// integer array and only decode keys and call the comparator on prefix ties.
+// Nothing is persisted; it is rebuilt whenever the block is loaded.
+//
+// Optionally (see BuildModel()), a piecewise linear model mapping a prefix to
+// its approximate position in the array is kept as well. A lookup then
+// predicts the position and only searches a small window around it, instead
+// of paying log2(N) dependent cache misses on large (index) blocks.
+class RestartKeyPrefixes {
+ public:
+  // Maximum distance between a predicted and an actual position for the
+  // restart keys the model was built on.
+  static constexpr uint32_t kModelMaxError = 8;
+  // Blocks with fewer restart points do not get a model; binary search over a
+  // handful of cache lines is already cheap.
+  static constexpr uint32_t kModelMinRestarts = 64;
+  // The model is dropped when it would need more than one segment per this
+  // many restart points.
+  static constexpr uint32_t kModelMinRestartsPerSegment = 8;
+
+  // Returns the first 8 bytes of `user_key` (zero-padded if shorter) as a
+  // big-endian integer. If the prefixes of two user keys differ, their integer
+  // order agrees with their BytewiseComparator() order.
+  static uint64_t UserKeyPrefix(const Slice& user_key);
+
+  // `prefixes` must hold `num_restarts` non-decreasing entries.
+  // `key_includes_seq` records whether the block keys are internal keys.
+  RestartKeyPrefixes(std::unique_ptr<uint64_t[]>&& prefixes,
+                     uint32_t num_restarts, bool key_includes_seq);
+
+  // No copying allowed
+  RestartKeyPrefixes(const RestartKeyPrefixes&) = delete;
+  void operator=(const RestartKeyPrefixes&) = delete;
+
+  // Fits a piecewise linear model over the prefixes with maximum error
+  // kModelMaxError. Does nothing for small blocks, or when the prefixes are
+  // too irregular for the model to be smaller than the array it indexes.
+  void BuildModel();
+
+  // Sets `*lower` to the first restart point whose prefix is not less than
+  // `target_prefix` and `*upper` to the first one whose prefix is greater. All
+  // restart keys before `*lower` are strictly less than any key with prefix
+  // `target_prefix`, and those at or after `*upper` are strictly greater.
+  void Seek(uint64_t target_prefix, uint32_t* lower, uint32_t* upper) const;
+
+  bool key_includes_seq() const { return key_includes_seq_; }
+  bool has_model() const { return !segments_.empty(); }
+  size_t ApproximateMemoryUsage() const;
+
+ private:
+  struct Segment {
+    uint64_t first_prefix;
+    uint32_t first_index;
+    double slope;
+  };
+
+  std::unique_ptr<uint64_t[]> prefixes_;
+  uint32_t num_restarts_;
+  bool key_includes_seq_;
+  std::vector<Segment> segments_;
+};
+
+}  // namespace ROCKSDB_NAMESPACE
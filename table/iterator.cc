@@ -9,12 +9,56 @@
 
 #include "rocksdb/iterator.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "memory/arena.h"
 #include "table/internal_iterator.h"
 #include "table/iterator_wrapper.h"
 
 namespace ROCKSDB_NAMESPACE {
 
+void KeyValueBatch::Clear() {
+  keys_.clear();
+  values_.clear();
+  if (buffers_.size() > 1) {
+    buffers_.erase(buffers_.begin(), buffers_.end() - 1);
+  }
+  buffer_used_ = 0;
+}
+
+void KeyValueBatch::Append(const Slice& key, bool key_pinned,
+                           const Slice& value, bool value_pinned) {
+  keys_.push_back(key_pinned ? key : Copy(key));
+  values_.push_back(value_pinned ? value : Copy(value));
+}
+
+Slice KeyValueBatch::Copy(const Slice& data) {
+  if (data.empty()) {
+    return Slice();
+  }
+  if (data.size() > buffer_size_ - buffer_used_) {
+    buffer_size_ = std::max(kBufferSize, data.size());
+    buffers_.emplace_back(new char[buffer_size_]);
+    buffer_used_ = 0;
+  }
+  char* const dest = buffers_.back().get() + buffer_used_;
+  memcpy(dest, data.data(), data.size());
+  buffer_used_ += data.size();
+  return Slice(dest, data.size());
+}
+
+Status Iterator::NextBatch(size_t max_entries, KeyValueBatch* batch) {
+  assert(batch);
+  batch->Clear();
+  for (size_t i = 0; i < max_entries && Valid(); ++i) {
+    batch->Append(key(), /*key_pinned=*/false, value(),
+                  /*value_pinned=*/false);
+    Next();
+  }
+  return status();
+}
+
 Status Iterator::GetProperty(std::string prop_name, std::string* prop) {
   if (prop == nullptr) {
     return Status::InvalidArgument("prop is nullptr");
@@ -179,6 +179,15 @@ static int RegisterBuiltinMemTableRepFactory(ObjectLibrary& library,
         }
         return guard->get();
       });
+  library.AddFactory<MemTableRepFactory>(
+      ObjectLibrary::PatternEntry(BTreeRepFactory::kClassName(), true)
+          .AnotherName(BTreeRepFactory::kNickName()),
+      [](const std::string& /*uri*/,
+         std::unique_ptr<MemTableRepFactory>* guard,
+         std::string* /*errmsg*/) {
+        guard->reset(new BTreeRepFactory());
+        return guard->get();
+      });
   library.AddFactory<MemTableRepFactory>(
       AsPattern("HashLinkListRepFactory", "hash_linkedlist"),
       [](const std::string& uri, std::unique_ptr<MemTableRepFactory>* guard,
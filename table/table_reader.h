@@ -169,6 +169,13 @@ class TableReader {
     return Status::OK();
   }
 
+  // Hints that a forward scan from the start of this table is likely to
+  // begin soon, e.g. because an iterator over the previous file of the same
+  // level is in progress. Implementations may issue a non-blocking readahead
+  // for the first data blocks so that the scan does not pay a cold read when
+  // it crosses into this file. Best effort; default implementation is NOOP.
+  virtual void PrefetchFirstDataBlocks(const ReadOptions& /*read_options*/) {}
+
   // convert db file to a human readable form
   virtual Status DumpTable(WritableFile* /*out_file*/) {
     return Status::NotSupported("DumpTable() not supported");
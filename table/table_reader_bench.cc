@@ -279,6 +279,18 @@ DEFINE_string(table_factory, "block_based",
 DEFINE_string(time_unit, "microsecond",
               "The time unit used for measuring performance. User can specify "
               "`microsecond` (default) or `nanosecond`");
+DEFINE_int32(index_type,
+             ROCKSDB_NAMESPACE::BlockBasedTableOptions().index_type,
+             "BlockBasedTableOptions::IndexType of the block based table, e.g. "
+             "0 for kBinarySearch or 2 for kTwoLevelIndexSearch");
+DEFINE_bool(index_block_learned_search,
+            ROCKSDB_NAMESPACE::BlockBasedTableOptions()
+                .index_block_learned_search,
+            "BlockBasedTableOptions::index_block_learned_search");
+DEFINE_bool(data_block_restart_key_prefixes,
+            ROCKSDB_NAMESPACE::BlockBasedTableOptions()
+                .data_block_restart_key_prefixes,
+            "BlockBasedTableOptions::data_block_restart_key_prefixes");
 
 int main(int argc, char** argv) {
   SetUsageMessage(std::string("\nUSAGE:\n") + std::string(argv[0]) +
@@ -315,7 +327,14 @@ int main(int argc, char** argv) {
     options.prefix_extractor.reset(
         ROCKSDB_NAMESPACE::NewFixedPrefixTransform(FLAGS_prefix_len));
   } else if (FLAGS_table_factory == "block_based") {
-    tf.reset(new ROCKSDB_NAMESPACE::BlockBasedTableFactory());
+    ROCKSDB_NAMESPACE::BlockBasedTableOptions table_options;
+    table_options.index_type =
+        static_cast<ROCKSDB_NAMESPACE::BlockBasedTableOptions::IndexType>(
+            FLAGS_index_type);
+    table_options.index_block_learned_search = FLAGS_index_block_learned_search;
+    table_options.data_block_restart_key_prefixes =
+        FLAGS_data_block_restart_key_prefixes;
+    tf.reset(new ROCKSDB_NAMESPACE::BlockBasedTableFactory(table_options));
   } else {
     fprintf(stderr, "Invalid table type %s\n", FLAGS_table_factory.c_str());
   }
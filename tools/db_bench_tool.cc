@@ -229,6 +229,8 @@ DEFINE_string(
     "\tresetstats  -- Reset DB stats\n"
     "\tlevelstats  -- Print the number of files and bytes per level\n"
     "\tmemstats  -- Print memtable stats\n"
+    "\twritestagestats -- Print the latency of each stage of the write path "
+    "(requires --statistics)\n"
     "\tsstables    -- Print sstable info\n"
     "\theapprofile -- Dump a heap profile (if supported by this port)\n"
     "\treplay      -- replay the trace file specified with trace_file\n"
@@ -310,6 +312,11 @@ DEFINE_int32(seek_nexts, 0,
              "fillseekseq, seekrandom, seekrandomwhilewriting and "
              "seekrandomwhilemerging");
 
+DEFINE_int32(iterator_next_batch_size, 0,
+             "If positive, readseq and forward seekrandom read entries with "
+             "Iterator::NextBatch() in batches of up to this many entries "
+             "instead of calling Next() for each entry");
+
 DEFINE_bool(reverse_iterator, false,
             "When true use Prev rather than Next for iterators that do "
             "Seek and then Next");
@@ -695,6 +702,20 @@ DEFINE_double(data_block_hash_table_util_ratio, 0.75,
               "This is only valid if use_data_block_hash_index is "
               "set to true");
 
+DEFINE_bool(data_block_restart_key_prefixes,
+            ROCKSDB_NAMESPACE::BlockBasedTableOptions()
+                .data_block_restart_key_prefixes,
+            "Build in-memory restart key prefixes for data blocks to speed "
+            "up seeks within a block. See "
+            "BlockBasedTableOptions::data_block_restart_key_prefixes");
+
+DEFINE_bool(index_block_learned_search,
+            ROCKSDB_NAMESPACE::BlockBasedTableOptions()
+                .index_block_learned_search,
+            "Build in-memory learned position models for index blocks to "
+            "speed up index seeks. See "
+            "BlockBasedTableOptions::index_block_learned_search");
+
 DEFINE_int64(compressed_cache_size, -1,
              "Number of bytes to use as a cache of compressed data.");
 
@@ -732,6 +753,9 @@ DEFINE_double(memtable_bloom_size_ratio, 0,
               "filter.");
 DEFINE_bool(memtable_whole_key_filtering, false,
             "Try to use whole key bloom filter in memtables.");
+DEFINE_double(memtable_hash_index_size_ratio, 0,
+              "Ratio of memtable size used for the buckets of the memtable "
+              "hash index for point lookups. 0 means no hash index.");
 DEFINE_bool(memtable_use_huge_page, false,
             "Try to use huge page in memtables.");
 
@@ -820,6 +844,11 @@ DEFINE_string(wal_compression, "none",
 static enum ROCKSDB_NAMESPACE::CompressionType FLAGS_wal_compression_e =
     ROCKSDB_NAMESPACE::kNoCompression;
 
+DEFINE_uint64(wal_compression_max_dict_bytes,
+              ROCKSDB_NAMESPACE::Options().wal_compression_max_dict_bytes,
+              "With WAL compression, prime each new WAL's compression with "
+              "up to this many bytes of the previous WAL's latest records.");
+
 DEFINE_string(wal_dir, "", "If not empty, use the given dir for WAL");
 
 DEFINE_string(truth_db, "/dev/shm/truth_db/dbbench",
@@ -909,6 +938,11 @@ DEFINE_bool(force_consistency_checks,
             "Runs consistency checks on the LSM every time a change is "
             "applied.");
 
+DEFINE_uint32(max_flush_partitions,
+              ROCKSDB_NAMESPACE::Options().max_flush_partitions,
+              "Maximum number of non-overlapping L0 files built in parallel "
+              "by one flush.");
+
 DEFINE_bool(check_flush_compaction_key_order,
             ROCKSDB_NAMESPACE::Options().check_flush_compaction_key_order,
             "During flush or compaction, check whether keys inserted to "
@@ -1173,6 +1207,10 @@ DEFINE_bool(optimize_multiget_for_io, true,
             "When set true, RocksDB does asynchronous reads for SST files in "
             "multiple levels for MultiGet.");
 
+DEFINE_uint64(multiget_parallelism, 1,
+              "Maximum number of threads, including the calling thread, used "
+              "by one MultiGet (ReadOptions::multiget_parallelism).");
+
 DEFINE_bool(charge_compression_dictionary_building_buffer, false,
             "Setting for "
             "CacheEntryRoleOptions::charged of "
@@ -1386,6 +1424,10 @@ DEFINE_uint64(soft_pending_compaction_bytes_limit, 64ull * 1024 * 1024 * 1024,
 DEFINE_uint64(hard_pending_compaction_bytes_limit, 128ull * 1024 * 1024 * 1024,
               "Stop writes if pending compaction bytes exceed this number");
 
+DEFINE_double(write_throttle_start_ratio, 0,
+              "Start slowing down writes gradually once this fraction of the "
+              "way to a write slowdown trigger. 0 means disabled.");
+
 DEFINE_uint64(delayed_write_rate, 8388608u,
               "Limited bytes allowed to DB when soft_rate_limit or "
               "level0_slowdown_writes_trigger triggers");
@@ -1424,6 +1466,16 @@ DEFINE_uint64(write_thread_slow_yield_usec, 3,
               "The threshold at which a slow yield is considered a signal that "
               "other processes or threads want the core.");
 
+DEFINE_bool(adaptive_write_group_size,
+            ROCKSDB_NAMESPACE::Options().adaptive_write_group_size,
+            "Size write groups from the observed write latency and writer "
+            "arrival rate.");
+
+DEFINE_uint64(write_group_max_wait_usec,
+              ROCKSDB_NAMESPACE::Options().write_group_max_wait_usec,
+              "With adaptive_write_group_size, the longest a sync write group "
+              "leader waits for more writers to join.");
+
 DEFINE_uint64(rate_limiter_bytes_per_sec, 0, "Set options.rate_limiter value.");
 
 DEFINE_int64(rate_limiter_refill_period_us, 100 * 1000,
@@ -3320,6 +3372,8 @@ class Benchmark {
       read_options_.adaptive_readahead = FLAGS_adaptive_readahead;
       read_options_.async_io = FLAGS_async_io;
       read_options_.optimize_multiget_for_io = FLAGS_optimize_multiget_for_io;
+      read_options_.multiget_parallelism =
+          static_cast<size_t>(FLAGS_multiget_parallelism);
 
       void (Benchmark::*method)(ThreadState*) = nullptr;
       void (Benchmark::*post_process_method)() = nullptr;
@@ -3561,6 +3615,9 @@ class Benchmark {
         VerifyDBFromDB(FLAGS_truth_db);
       } else if (name == "levelstats") {
         PrintStats("rocksdb.levelstats");
+      } else if (name == "writestagestats") {
+        // DB::Properties::kDBWriteStageStats
+        PrintStats("rocksdb.db-write-stage-stats");
       } else if (name == "memstats") {
         std::vector<std::string> keys{"rocksdb.num-immutable-mem-table",
                                       "rocksdb.cur-size-active-mem-table",
@@ -3753,6 +3810,13 @@ class Benchmark {
 
     if (FLAGS_statistics) {
       fprintf(stdout, "STATISTICS:\n%s\n", dbstats->ToString().c_str());
+      if (db_.db != nullptr) {
+        std::string write_stages;
+        if (db_.db->GetProperty("rocksdb.db-write-stage-stats",
+                                &write_stages)) {
+          fprintf(stdout, "WRITE STAGES:\n%s\n", write_stages.c_str());
+        }
+      }
     }
     if (FLAGS_simcache_size >= 0) {
       fprintf(
@@ -4098,6 +4162,8 @@ class Benchmark {
         FLAGS_use_direct_io_for_flush_and_compaction;
     options.manual_wal_flush = FLAGS_manual_wal_flush;
     options.wal_compression = FLAGS_wal_compression_e;
+    options.wal_compression_max_dict_bytes =
+        static_cast<size_t>(FLAGS_wal_compression_max_dict_bytes);
     options.ttl = FLAGS_fifo_compaction_ttl;
     options.compaction_options_fifo = CompactionOptionsFIFO(
         FLAGS_fifo_compaction_max_table_files_size_mb * 1024 * 1024,
@@ -4117,6 +4183,8 @@ class Benchmark {
     options.memtable_huge_page_size = FLAGS_memtable_use_huge_page ? 2048 : 0;
     options.memtable_prefix_bloom_size_ratio = FLAGS_memtable_bloom_size_ratio;
     options.memtable_whole_key_filtering = FLAGS_memtable_whole_key_filtering;
+    options.memtable_hash_index_size_ratio =
+        FLAGS_memtable_hash_index_size_ratio;
     if (FLAGS_memtable_insert_with_hint_prefix_size > 0) {
       options.memtable_insert_with_hint_prefix_extractor.reset(
           NewCappedPrefixTransform(
@@ -4327,6 +4395,10 @@ class Benchmark {
       }
       block_based_options.data_block_hash_table_util_ratio =
           FLAGS_data_block_hash_table_util_ratio;
+      block_based_options.data_block_restart_key_prefixes =
+          FLAGS_data_block_restart_key_prefixes;
+      block_based_options.index_block_learned_search =
+          FLAGS_index_block_learned_search;
       if (FLAGS_read_cache_path != "") {
         Status rc_status;
 
@@ -4454,6 +4526,7 @@ class Benchmark {
         FLAGS_soft_pending_compaction_bytes_limit;
     options.hard_pending_compaction_bytes_limit =
         FLAGS_hard_pending_compaction_bytes_limit;
+    options.write_throttle_start_ratio = FLAGS_write_throttle_start_ratio;
     options.delayed_write_rate = FLAGS_delayed_write_rate;
     options.allow_concurrent_memtable_write =
         FLAGS_allow_concurrent_memtable_write;
@@ -4467,12 +4540,15 @@ class Benchmark {
     options.unordered_write = FLAGS_unordered_write;
     options.write_thread_max_yield_usec = FLAGS_write_thread_max_yield_usec;
     options.write_thread_slow_yield_usec = FLAGS_write_thread_slow_yield_usec;
+    options.adaptive_write_group_size = FLAGS_adaptive_write_group_size;
+    options.write_group_max_wait_usec = FLAGS_write_group_max_wait_usec;
     options.table_cache_numshardbits = FLAGS_table_cache_numshardbits;
     options.max_compaction_bytes = FLAGS_max_compaction_bytes;
     options.disable_auto_compactions = FLAGS_disable_auto_compactions;
     options.optimize_filters_for_hits = FLAGS_optimize_filters_for_hits;
     options.paranoid_checks = FLAGS_paranoid_checks;
     options.force_consistency_checks = FLAGS_force_consistency_checks;
+    options.max_flush_partitions = FLAGS_max_flush_partitions;
     options.check_flush_compaction_key_order =
         FLAGS_check_flush_compaction_key_order;
     options.periodic_compaction_seconds = FLAGS_periodic_compaction_seconds;
@@ -5705,16 +5781,39 @@ class Benchmark {
     Iterator* iter = db->NewIterator(options);
     int64_t i = 0;
     int64_t bytes = 0;
-    for (iter->SeekToFirst(); i < reads_ && iter->Valid(); iter->Next()) {
-      bytes += iter->key().size() + iter->value().size();
-      thread->stats.FinishedOps(nullptr, db, 1, kRead);
-      ++i;
+    if (FLAGS_iterator_next_batch_size > 0) {
+      KeyValueBatch batch;
+      iter->SeekToFirst();
+      while (i < reads_ && iter->Valid()) {
+        iter->NextBatch(
+            static_cast<size_t>(std::min<int64_t>(
+                FLAGS_iterator_next_batch_size, reads_ - i)),
+            &batch);
+        for (size_t j = 0; j < batch.size(); ++j) {
+          bytes += batch.keys()[j].size() + batch.values()[j].size();
+        }
+        const int64_t num_read = static_cast<int64_t>(batch.size());
+        thread->stats.FinishedOps(nullptr, db, num_read, kRead);
+        i += num_read;
+
+        if (thread->shared->read_rate_limiter.get() != nullptr) {
+          thread->shared->read_rate_limiter->Request(
+              num_read, Env::IO_HIGH, nullptr /* stats */,
+              RateLimiter::OpType::kRead);
+        }
+      }
+    } else {
+      for (iter->SeekToFirst(); i < reads_ && iter->Valid(); iter->Next()) {
+        bytes += iter->key().size() + iter->value().size();
+        thread->stats.FinishedOps(nullptr, db, 1, kRead);
+        ++i;
 
-      if (thread->shared->read_rate_limiter.get() != nullptr &&
-          i % 1024 == 1023) {
-        thread->shared->read_rate_limiter->Request(1024, Env::IO_HIGH,
-                                                   nullptr /* stats */,
-                                                   RateLimiter::OpType::kRead);
+        if (thread->shared->read_rate_limiter.get() != nullptr &&
+            i % 1024 == 1023) {
+          thread->shared->read_rate_limiter->Request(
+              1024, Env::IO_HIGH, nullptr /* stats */,
+              RateLimiter::OpType::kRead);
+        }
       }
     }
 
@@ -6628,6 +6727,7 @@ class Benchmark {
 
     Duration duration(FLAGS_duration, reads_);
     char value_buffer[256];
+    KeyValueBatch batch;
     while (!duration.Done(1)) {
       int64_t seek_pos = thread->rand.Next() % FLAGS_num;
       GenerateKeyFromIntForSeek(static_cast<uint64_t>(seek_pos), FLAGS_num,
@@ -6680,19 +6780,37 @@ class Benchmark {
         found++;
       }
 
-      for (int j = 0; j < FLAGS_seek_nexts && iter_to_use->Valid(); ++j) {
-        // Copy out iterator's value to make sure we read them.
-        Slice value = iter_to_use->value();
-        memcpy(value_buffer, value.data(),
-               std::min(value.size(), sizeof(value_buffer)));
-        bytes += iter_to_use->key().size() + iter_to_use->value().size();
+      if (FLAGS_iterator_next_batch_size > 0 && !FLAGS_reverse_iterator) {
+        for (int j = 0; j < FLAGS_seek_nexts && iter_to_use->Valid();) {
+          iter_to_use->NextBatch(
+              static_cast<size_t>(std::min(FLAGS_iterator_next_batch_size,
+                                           FLAGS_seek_nexts - j)),
+              &batch);
+          for (size_t k = 0; k < batch.size(); ++k) {
+            // Copy out iterator's value to make sure we read them.
+            const Slice& value = batch.values()[k];
+            memcpy(value_buffer, value.data(),
+                   std::min(value.size(), sizeof(value_buffer)));
+            bytes += batch.keys()[k].size() + value.size();
+          }
+          j += static_cast<int>(batch.size());
+          assert(iter_to_use->status().ok());
+        }
+      } else {
+        for (int j = 0; j < FLAGS_seek_nexts && iter_to_use->Valid(); ++j) {
+          // Copy out iterator's value to make sure we read them.
+          Slice value = iter_to_use->value();
+          memcpy(value_buffer, value.data(),
+                 std::min(value.size(), sizeof(value_buffer)));
+          bytes += iter_to_use->key().size() + iter_to_use->value().size();
 
-        if (!FLAGS_reverse_iterator) {
-          iter_to_use->Next();
-        } else {
-          iter_to_use->Prev();
+          if (!FLAGS_reverse_iterator) {
+            iter_to_use->Next();
+          } else {
+            iter_to_use->Prev();
+          }
+          assert(iter_to_use->status().ok());
         }
-        assert(iter_to_use->status().ok());
       }
 
       if (thread->shared->read_rate_limiter.get() != nullptr &&
@@ -86,6 +86,7 @@ default_params = {
     "get_current_wal_file_one_in": 0,
     # Temporarily disable hash index
     "index_type": lambda: random.choice([0, 0, 0, 2, 2, 3]),
+    "index_block_learned_search": lambda: random.randint(0, 1),
     "ingest_external_file_one_in": 1000000,
     "iterpercent": 10,
     "lock_wal_one_in": 1000000,
@@ -83,6 +83,17 @@ void ZSTDStreamingCompress::Reset() {
 #endif
 }
 
+bool ZSTDStreamingCompress::LoadDictionary(const Slice& dict) {
+#ifdef ZSTD_STREAMING
+  // The dictionary is copied and stays loaded across session resets.
+  return !ZSTD_isError(
+      ZSTD_CCtx_loadDictionary(cctx_, dict.data(), dict.size()));
+#else
+  (void)dict;
+  return false;
+#endif
+}
+
 int ZSTDStreamingUncompress::Uncompress(const char* input, size_t input_size,
                                         char* output, size_t* output_pos) {
   assert(output != nullptr && output_pos != nullptr);
@@ -119,4 +130,14 @@ void ZSTDStreamingUncompress::Reset() {
 #endif
 }
 
+bool ZSTDStreamingUncompress::LoadDictionary(const Slice& dict) {
+#ifdef ZSTD_STREAMING
+  return !ZSTD_isError(
+      ZSTD_DCtx_loadDictionary(dctx_, dict.data(), dict.size()));
+#else
+  (void)dict;
+  return false;
+#endif
+}
+
 }  // namespace ROCKSDB_NAMESPACE
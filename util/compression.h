@@ -1616,17 +1616,24 @@ inline CacheAllocationPtr UncompressData(
   }
 }
 
-// Records the compression type for subsequent WAL records.
+// Records the compression type for subsequent WAL records, and optionally a
+// raw content dictionary that they are compressed with.
 class CompressionTypeRecord {
  public:
-  explicit CompressionTypeRecord(CompressionType compression_type)
-      : compression_type_(compression_type) {}
+  explicit CompressionTypeRecord(CompressionType compression_type,
+                                 const Slice& dict = Slice())
+      : compression_type_(compression_type), dict_(dict.ToString()) {}
 
   CompressionType GetCompressionType() const { return compression_type_; }
+  const std::string& GetDictionary() const { return dict_; }
 
   inline void EncodeTo(std::string* dst) const {
     assert(dst != nullptr);
     PutFixed32(dst, compression_type_);
+    // Omitted when empty, for compatibility with older readers
+    if (!dict_.empty()) {
+      PutLengthPrefixedSlice(dst, dict_);
+    }
   }
 
   inline Status DecodeFrom(Slice* src) {
@@ -1643,15 +1650,26 @@ class CompressionTypeRecord {
                                 "WAL compression type not supported");
     }
     compression_type_ = compression_type;
+    dict_.clear();
+    if (!src->empty()) {
+      Slice dict;
+      if (!GetLengthPrefixedSlice(src, &dict)) {
+        return Status::Corruption(class_name,
+                                  "Error decoding WAL compression dictionary");
+      }
+      dict_ = dict.ToString();
+    }
     return Status::OK();
   }
 
   inline std::string DebugString() const {
-    return "compression_type: " + CompressionTypeToString(compression_type_);
+    return "compression_type: " + CompressionTypeToString(compression_type_) +
+           ", dictionary size: " + std::to_string(dict_.size());
   }
 
  private:
   CompressionType compression_type_;
+  std::string dict_;
 };
 
 // Base class to implement compression for a stream of buffers.
@@ -1689,6 +1707,10 @@ class StreamingCompress {
                                    uint32_t compress_format_version,
                                    size_t max_output_len);
   virtual void Reset() = 0;
+  // Compress all subsequent frames with dict as a raw content dictionary.
+  // Must be called before the first Compress(). Returns false if not
+  // supported.
+  virtual bool LoadDictionary(const Slice& /*dict*/) { return false; }
 
  protected:
   const CompressionType compression_type_;
@@ -1729,6 +1751,10 @@ class StreamingUncompress {
                                      uint32_t compress_format_version,
                                      size_t max_output_len);
   virtual void Reset() = 0;
+  // Uncompress all subsequent frames with dict as a raw content dictionary.
+  // Must be called before the first Uncompress(). Returns false if not
+  // supported.
+  virtual bool LoadDictionary(const Slice& /*dict*/) { return false; }
 
  protected:
   CompressionType compression_type_;
@@ -1759,6 +1785,7 @@ class ZSTDStreamingCompress final : public StreamingCompress {
   int Compress(const char* input, size_t input_size, char* output,
                size_t* output_pos) override;
   void Reset() override;
+  bool LoadDictionary(const Slice& dict) override;
 #ifdef ZSTD_STREAMING
   ZSTD_CCtx* cctx_;
   ZSTD_inBuffer input_buffer_;
@@ -1784,6 +1811,7 @@ class ZSTDStreamingUncompress final : public StreamingUncompress {
   int Uncompress(const char* input, size_t input_size, char* output,
                  size_t* output_size) override;
   void Reset() override;
+  bool LoadDictionary(const Slice& dict) override;
 
  private:
 #ifdef ZSTD_STREAMING
@@ -29,6 +29,12 @@ class FileChecksumGenCrc32c : public FileChecksumGenerator {
     checksum_ = crc32c::Extend(checksum_, data, n);
   }
 
+  // Same as Update() for `n` bytes of data whose crc32c is already known
+  // to be `crc`, without reading the data again.
+  void UpdateWithCrc32c(uint32_t crc, size_t n) {
+    checksum_ = crc32c::Crc32cCombine(checksum_, crc, n);
+  }
+
   void Finalize() override {
     assert(checksum_str_.empty());
     // Store as big endian raw bytes
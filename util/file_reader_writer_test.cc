@@ -18,6 +18,7 @@
 #include "test_util/testharness.h"
 #include "test_util/testutil.h"
 #include "util/crc32c.h"
+#include "util/file_checksum_helper.h"
 #include "util/random.h"
 #include "utilities/fault_injection_fs.h"
 
@@ -473,6 +474,34 @@ TEST_F(WritableFileWriterTest, AppendStatusReturn) {
   ASSERT_NOK(writer->Append(std::string(2 * kMb, 'b')));
 }
 
+TEST_F(WritableFileWriterTest, Crc32cFileChecksumFromAppendChecksum) {
+  std::unique_ptr<FSWritableFile> sink(new test::StringSink());
+  std::unique_ptr<WritableFileWriter> writer(new WritableFileWriter(
+      std::move(sink), "" /* don't care */, FileOptions(),
+      SystemClock::Default().get(), nullptr /* io_tracer */,
+      nullptr /* stats */, {} /* listeners */,
+      GetFileChecksumGenCrc32cFactory().get()));
+  FileChecksumGenContext context;
+  FileChecksumGenCrc32c expected(context);
+
+  // Mix appends with and without the crc32c of the data
+  Random rnd(301);
+  for (int i = 0; i < 100; i++) {
+    std::string data = rnd.RandomString(rnd.Uniform(5000));
+    if (rnd.OneIn(2)) {
+      ASSERT_OK(writer->Append(data, crc32c::Value(data.data(), data.size())));
+    } else {
+      ASSERT_OK(writer->Append(data));
+    }
+    expected.Update(data.data(), data.size());
+  }
+  ASSERT_OK(writer->Close());
+
+  expected.Finalize();
+  ASSERT_EQ(expected.GetChecksum(), writer->GetFileChecksum());
+  ASSERT_STREQ(expected.Name(), writer->GetFileChecksumFuncName());
+}
+
 class ReadaheadRandomAccessFileTest
     : public testing::Test,
       public testing::WithParamInterface<size_t> {
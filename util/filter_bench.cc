@@ -26,6 +26,7 @@ int main() {
 #include "table/block_based/filter_policy_internal.h"
 #include "table/block_based/full_filter_block.h"
 #include "table/block_based/mock_block_based_table.h"
+#include "table/multiget_context.h"
 #include "table/plain/plain_table_bloom.h"
 #include "util/cast_util.h"
 #include "util/gflags_compat.h"
@@ -62,7 +63,9 @@ DEFINE_uint32(vary_key_size_log2_interval, 5,
               "Use same key size 2^n times, then change. Key size varies from "
               "-2 to +2 bytes vs. average, unless n>=30 to fix key size.");
 
-DEFINE_uint32(batch_size, 8, "Number of keys to group in each batch");
+DEFINE_uint32(batch_size, 8,
+              "Number of keys to group in each batch (at most 32, the "
+              "MultiGet batch size)");
 
 DEFINE_double(bits_per_key, 10.0, "Bits per key setting for filters");
 
@@ -141,6 +144,7 @@ void _always_assert_fail(int line, const char *file, const char *expr) {
 #endif
 
 using ROCKSDB_NAMESPACE::Arena;
+using ROCKSDB_NAMESPACE::autovector;
 using ROCKSDB_NAMESPACE::BlockContents;
 using ROCKSDB_NAMESPACE::BloomFilterPolicy;
 using ROCKSDB_NAMESPACE::BloomHash;
@@ -159,11 +163,14 @@ using ROCKSDB_NAMESPACE::FilterPolicy;
 using ROCKSDB_NAMESPACE::FullFilterBlockReader;
 using ROCKSDB_NAMESPACE::GetSliceHash;
 using ROCKSDB_NAMESPACE::GetSliceHash64;
+using ROCKSDB_NAMESPACE::KeyContext;
 using ROCKSDB_NAMESPACE::Lower32of64;
 using ROCKSDB_NAMESPACE::LRUCacheOptions;
+using ROCKSDB_NAMESPACE::MultiGetContext;
 using ROCKSDB_NAMESPACE::ParsedFullFilterBlock;
 using ROCKSDB_NAMESPACE::PlainTableBloomV1;
 using ROCKSDB_NAMESPACE::Random32;
+using ROCKSDB_NAMESPACE::ReadOptions;
 using ROCKSDB_NAMESPACE::Slice;
 using ROCKSDB_NAMESPACE::static_cast_with_check;
 using ROCKSDB_NAMESPACE::Status;
@@ -659,6 +666,8 @@ double FilterBench::RandomQueryTest(uint32_t inside_threshold, bool dry_run,
     batch_slice_ptrs[i] = &batch_slices[i];
   }
 
+  const ReadOptions read_options;
+
   ROCKSDB_NAMESPACE::StopWatchNano timer(
       ROCKSDB_NAMESPACE::SystemClock::Default().get(), true);
 
@@ -685,10 +694,8 @@ double FilterBench::RandomQueryTest(uint32_t inside_threshold, bool dry_run,
         info.outside_queries_++;
       }
     }
-    // TODO: implement batched interface to full block reader
     // TODO: implement batched interface to plain table bloom
-    if (mode == kBatchPrepared && !FLAGS_use_full_block_reader &&
-        !FLAGS_use_plain_table_bloom) {
+    if (mode == kBatchPrepared && !FLAGS_use_plain_table_bloom) {
       for (uint32_t i = 0; i < batch_size; ++i) {
         batch_results[i] = false;
       }
@@ -697,6 +704,28 @@ double FilterBench::RandomQueryTest(uint32_t inside_threshold, bool dry_run,
           batch_results[i] = true;
           dry_run_hash += dry_run_hash_fn(batch_slices[i]);
         }
+      } else if (FLAGS_use_full_block_reader) {
+        // Same path as a MultiGet batch against one SST file
+        autovector<KeyContext, MultiGetContext::MAX_BATCH_SIZE> key_contexts;
+        autovector<KeyContext*, MultiGetContext::MAX_BATCH_SIZE> sorted_keys;
+        for (uint32_t i = 0; i < batch_size; ++i) {
+          key_contexts.emplace_back(/*col_family=*/nullptr, batch_slices[i],
+                                    /*val=*/nullptr, /*cols=*/nullptr,
+                                    /*ts=*/nullptr, /*stat=*/nullptr);
+        }
+        for (auto &key_context : key_contexts) {
+          sorted_keys.push_back(&key_context);
+        }
+        MultiGetContext ctx(&sorted_keys, 0, batch_size,
+                            ROCKSDB_NAMESPACE::kMaxSequenceNumber,
+                            read_options, /*fs=*/nullptr, /*stats=*/nullptr);
+        MultiGetContext::Range range = ctx.GetMultiGetRange();
+        info.full_block_reader_->KeysMayMatch(
+            &range, /*no_io=*/false, /*lookup_context=*/nullptr,
+            Env::IO_TOTAL);
+        for (auto iter = range.begin(); iter != range.end(); ++iter) {
+          batch_results[iter.index()] = true;
+        }
       } else {
         info.reader_->MayMatch(batch_size, batch_slice_ptrs.get(),
                                batch_results.get());
@@ -798,6 +827,13 @@ int main(int argc, char **argv) {
 
   PrintWarnings();
 
+  if (FLAGS_batch_size < 1 ||
+      FLAGS_batch_size >
+          static_cast<uint32_t>(MultiGetContext::MAX_BATCH_SIZE)) {
+    PrintError("-batch_size must be between 1 and 32");
+    return 1;
+  }
+
   if (FLAGS_legend) {
     std::cout
         << "Legend:" << std::endl
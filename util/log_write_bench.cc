@@ -11,13 +11,19 @@ int main() {
 }
 #else
 
+#include <cinttypes>
+
+#include "db/log_writer.h"
 #include "file/writable_file_writer.h"
 #include "monitoring/histogram.h"
 #include "rocksdb/env.h"
 #include "rocksdb/system_clock.h"
 #include "test_util/testharness.h"
 #include "test_util/testutil.h"
+#include "util/compression.h"
 #include "util/gflags_compat.h"
+#include "util/random.h"
+#include "util/string_util.h"
 
 using GFLAGS_NAMESPACE::ParseCommandLineFlags;
 using GFLAGS_NAMESPACE::SetUsageMessage;
@@ -29,6 +35,15 @@ DEFINE_int32(record_size, 249, "Size of each record.");
 DEFINE_int32(record_interval, 10000, "Interval between records (microSec)");
 DEFINE_int32(bytes_per_sync, 0, "bytes_per_sync parameter in EnvOptions");
 DEFINE_bool(enable_sync, false, "sync after each write.");
+DEFINE_string(wal_compression, "none",
+              "If zstd, write records as a compressed WAL through "
+              "log::Writer instead of appending them to the file directly.");
+DEFINE_int64(wal_compression_max_dict_bytes, 0,
+             "With -wal_compression, prime the compression with this many "
+             "bytes of records from a previously written WAL.");
+DEFINE_int32(record_vocabulary_size, 1024,
+             "Records are made of 8-byte words drawn from this many distinct "
+             "words, like the repeated keys and fields of a workload.");
 
 namespace ROCKSDB_NAMESPACE {
 void RunBenchmark() {
@@ -38,25 +53,90 @@ void RunBenchmark() {
   const auto& clock = env->GetSystemClock();
   EnvOptions env_options = env->OptimizeForLogWrite(EnvOptions(), options);
   env_options.bytes_per_sync = FLAGS_bytes_per_sync;
-  std::unique_ptr<WritableFile> file;
-  env->NewWritableFile(file_name, &file, env_options);
-  std::unique_ptr<WritableFileWriter> writer;
-  writer.reset(new WritableFileWriter(std::move(file), file_name, env_options,
-                                      clock, nullptr /* stats */,
-                                      options.listeners));
+  const auto& fs = env->GetFileSystem();
+  auto new_file_writer = [&](const std::string& fname) {
+    std::unique_ptr<FSWritableFile> file;
+    fs->NewWritableFile(fname, FileOptions(env_options), &file, nullptr)
+        .PermitUncheckedError();
+    return std::unique_ptr<WritableFileWriter>(new WritableFileWriter(
+        std::move(file), fname, FileOptions(env_options), clock.get(),
+        nullptr /* io_tracer */, nullptr /* stats */, options.listeners));
+  };
+  std::unique_ptr<WritableFileWriter> writer = new_file_writer(file_name);
+
+  CompressionType compression_type = kNoCompression;
+  if (!FLAGS_wal_compression.empty() && FLAGS_wal_compression != "none") {
+    compression_type = FLAGS_wal_compression == "zstd"
+                           ? kZSTD
+                           : kDisableCompressionOption;
+    if (!StreamingCompressionTypeSupported(compression_type)) {
+      fprintf(stderr, "WAL compression type %s is not supported\n",
+              FLAGS_wal_compression.c_str());
+      exit(1);
+    }
+  }
+
+  Random rnd(301);
+  std::vector<std::string> words(std::max(FLAGS_record_vocabulary_size, 1));
+  for (auto& word : words) {
+    word = rnd.RandomString(8);
+  }
+  auto generate_record = [&]() {
+    std::string record;
+    while (record.size() < static_cast<size_t>(FLAGS_record_size)) {
+      record.append(words[rnd.Uniform(static_cast<int>(words.size()))]);
+    }
+    record.resize(FLAGS_record_size);
+    return record;
+  };
+  std::vector<std::string> records(FLAGS_num_records);
+  for (auto& record : records) {
+    record = generate_record();
+  }
 
-  std::string record;
-  record.assign(FLAGS_record_size, 'X');
+  std::unique_ptr<log::Writer> log_writer;
+  if (compression_type != kNoCompression) {
+    std::string dict;
+    if (FLAGS_wal_compression_max_dict_bytes > 0) {
+      // Write a previous WAL to take the dictionary from, as the DB does
+      std::string prev_file_name = file_name + ".prev";
+      log::Writer prev_log_writer(
+          new_file_writer(prev_file_name), /*log_number=*/1,
+          /*recycle_log_files=*/false, /*manual_flush=*/false,
+          compression_type,
+          static_cast<size_t>(FLAGS_wal_compression_max_dict_bytes));
+      prev_log_writer.AddCompressionTypeRecord();
+      for (int64_t written = 0; written < FLAGS_wal_compression_max_dict_bytes;
+           written += FLAGS_record_size) {
+        prev_log_writer.AddRecord(generate_record());
+      }
+      dict = prev_log_writer.RecentRecordData().ToString();
+      prev_log_writer.Close();
+      env->DeleteFile(prev_file_name);
+    }
+    log_writer.reset(new log::Writer(std::move(writer), /*log_number=*/2,
+                                     /*recycle_log_files=*/false,
+                                     /*manual_flush=*/false, compression_type));
+    log_writer->AddCompressionTypeRecord(dict);
+  }
 
   HistogramImpl hist;
 
   uint64_t start_time = clock->NowMicros();
   for (int i = 0; i < FLAGS_num_records; i++) {
+    const std::string& record = records[i];
     uint64_t start_nanos = clock->NowNanos();
-    writer->Append(record);
-    writer->Flush();
-    if (FLAGS_enable_sync) {
-      writer->Sync(false);
+    if (log_writer) {
+      log_writer->AddRecord(record);
+      if (FLAGS_enable_sync) {
+        log_writer->file()->Sync(false);
+      }
+    } else {
+      writer->Append(record);
+      writer->Flush();
+      if (FLAGS_enable_sync) {
+        writer->Sync(false);
+      }
     }
     hist.Add(clock->NowNanos() - start_nanos);
 
@@ -73,6 +153,11 @@ void RunBenchmark() {
 
   fprintf(stderr, "Distribution of latency of append+flush: \n%s",
           hist.ToString().c_str());
+  uint64_t file_size = log_writer ? log_writer->file()->GetFileSize()
+                                  : writer->GetFileSize();
+  fprintf(stderr, "Wrote %" PRIu64 " bytes for %" PRIu64 " record bytes\n",
+          file_size,
+          static_cast<uint64_t>(FLAGS_num_records) * FLAGS_record_size);
 }
 }  // namespace ROCKSDB_NAMESPACE
 